@@ -92,6 +92,7 @@
 #  define _MAC
 #endif // #if !defined(_MAC) && (defined(_68K_) || defined(_MPPC_))
 
+#include <cstdint>
 #include <string>
 
 namespace solution
@@ -111,6 +112,10 @@ namespace solution
             std::string cumulative_distances_scale_1;
             std::string cumulative_distances_scale_2;
 
+            bool required_text_matrices    = false; // binary matrices are always saved
+            bool required_float32_matrices = false;
+            bool required_matrices_cache   = false; // recompute only rows of changed charts
+
             bool required_price_deviations = false;
 
             bool required_tagged_charts = false;
@@ -119,6 +124,12 @@ namespace solution
 
             bool required_local_environment = false;
 
+            bool required_dataset = false; // NPY arrays for training, train and test row ranges
+
+            bool required_dry_run = false; // report stages to execute without running them
+
+            bool required_dataflow = false; // per-asset chains instead of global phases
+
             double min_price_change   = 0.020;
             double max_price_rollback = 0.333;
 
@@ -189,6 +200,22 @@ namespace solution
 
             unsigned int intraday_test_year = 0U;
 
+            bool run_event_study = false;
+
+            std::string event_study_scale = "D";
+            std::string event_study_conditions; // "weekday[-1] == 3 && weekday == 4 && year >= 2015"
+
+            std::size_t event_study_horizon = 1U;
+
+            double event_study_threshold = 0.005;
+
+            bool event_study_is_relative = true; // threshold and returns relative to previous close
+
+            double event_study_confidence = 0.95;
+
+            std::size_t significance_resamples = 10000U; // 0: no bootstrap and permutation tests
+            std::uint64_t significance_seed = 0ULL;
+
             std::string local_environment_test_asset;
             std::string local_environment_test_scale;
 
@@ -200,8 +227,18 @@ namespace solution
 
             std::size_t movement_timesteps = 1U;
 
+            std::size_t regression_horizons = 1U;
+
             std::time_t knn_method_timesteps = 10LL;
 
+            bool run_knn_benchmark = false; // HNSW recall and latency against exact KNN
+
+            std::size_t hnsw_max_connections = 16U;
+            std::size_t hnsw_ef_construction = 200U;
+            std::size_t hnsw_max_ef_search   = 256U;
+
+            std::size_t knn_rerank_size = 32U; // int8 candidates rescored in full precision, 0: none
+
             std::size_t max_waves_sequence = 5U;
 
             std::size_t local_environment_test_start = 2000U;
@@ -213,6 +250,11 @@ namespace solution
             std::size_t test_data_start = 2020U;
 
             std::size_t skipped_timesteps = 125U;
+
+            std::size_t executor_size = 0U; // 0: hardware concurrency
+
+            bool required_thread_affinity = false;
+            bool required_numa_placement  = false;
         };
 
     } // namespace system
@@ -0,0 +1,111 @@
+#include "calendar.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void Calendar::initialize(const candles_container_t & candles)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto size = std::size(candles);
+
+					m_weekdays.reserve(size);
+					m_hours   .reserve(size);
+					m_days    .reserve(size);
+					m_months  .reserve(size);
+					m_years   .reserve(size);
+					m_ordinals.reserve(size);
+
+					m_timestamps.reserve(size);
+
+					std::uint32_t ordinal = 0U;
+
+					for (auto i = 0U; i < size; ++i)
+					{
+						const auto & date_time = candles[i].date_time;
+
+						if (i > 0U)
+						{
+							const auto & previous = candles[i - 1U].date_time;
+
+							if (date_time < previous)
+							{
+								throw std::logic_error("candles are not sorted by date");
+							}
+
+							if (date_time.day != previous.day || date_time.month != previous.month || date_time.year != previous.year)
+							{
+								++ordinal;
+							}
+						}
+
+						m_weekdays.push_back(static_cast < std::uint8_t  > (weekday(date_time)));
+						m_hours   .push_back(static_cast < std::uint8_t  > (date_time.hour));
+						m_days    .push_back(static_cast < std::uint8_t  > (date_time.day));
+						m_months  .push_back(static_cast < std::uint8_t  > (date_time.month));
+						m_years   .push_back(static_cast < std::uint16_t > (date_time.year));
+
+						m_ordinals.push_back(ordinal);
+
+						m_timestamps.push_back(date_time.to_timestamp());
+
+						if (i == 0U || m_years[i] != m_years[i - 1U])
+						{
+							m_year_ranges.push_back(Year { date_time.year, { i, i } });
+						}
+
+						m_year_ranges.back().rows.second = i + 1U;
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < calendar_exception > (logger, exception);
+				}
+			}
+
+			Calendar::range_t Calendar::rows(unsigned int year) const noexcept
+			{
+				const auto iterator = std::lower_bound(std::begin(m_year_ranges), std::end(m_year_ranges), year,
+					[](const auto & range, auto year) { return (range.year < year); });
+
+				return ((iterator != std::end(m_year_ranges) && iterator->year == year) ?
+					iterator->rows : range_t(size(), size()));
+			}
+
+			std::size_t Calendar::first_row(unsigned int year) const noexcept
+			{
+				const auto iterator = std::lower_bound(std::begin(m_year_ranges), std::end(m_year_ranges), year,
+					[](const auto & range, auto year) { return (range.year < year); });
+
+				return ((iterator != std::end(m_year_ranges)) ? iterator->rows.first : size());
+			}
+
+			Calendar::range_t Calendar::rows(timestamp_t from, timestamp_t to) const noexcept
+			{
+				const auto first = std::lower_bound(std::begin(m_timestamps), std::end(m_timestamps), from);
+				const auto last  = std::lower_bound(first, std::end(m_timestamps), std::max(from, to));
+
+				return range_t(
+					static_cast < std::size_t > (std::distance(std::begin(m_timestamps), first)),
+					static_cast < std::size_t > (std::distance(std::begin(m_timestamps), last)));
+			}
+
+			unsigned int Calendar::weekday(const Date_Time & date_time) noexcept
+			{
+				const auto timestamp = date_time.to_timestamp();
+
+				const auto days = (timestamp >= 0 ? timestamp / 86400 : (timestamp - 86399) / 86400);
+
+				return static_cast < unsigned int > (((days + 3) % 7 + 7) % 7); // note: 1970/01/01 is Thursday
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,162 @@
+#ifndef SOLUTION_SYSTEM_MARKET_CALENDAR_HPP
+#define SOLUTION_SYSTEM_MARKET_CALENDAR_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/range/iterator_range.hpp>
+
+#include "../candle/candle.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class calendar_exception : public std::exception
+			{
+			public:
+
+				explicit calendar_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit calendar_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~calendar_exception() noexcept = default;
+			};
+
+			class Calendar // note: calendar columns of one chart, built once at load time
+			{
+			public:
+
+				using candles_container_t = std::vector < Candle > ;
+
+				using timestamp_t = Date_Time::timestamp_t;
+
+				using range_t = std::pair < std::size_t, std::size_t > ; // note: rows [first, last)
+
+				struct Year
+				{
+					unsigned int year = 0U;
+
+					range_t rows;
+				};
+
+				using years_container_t = std::vector < Year > ;
+
+			public:
+
+				Calendar() = default;
+
+				explicit Calendar(const candles_container_t & candles)
+				{
+					initialize(candles);
+				}
+
+				~Calendar() noexcept = default;
+
+			private:
+
+				void initialize(const candles_container_t & candles);
+
+			public:
+
+				std::size_t size() const noexcept
+				{
+					return std::size(m_years);
+				}
+
+				unsigned int weekday(std::size_t i) const noexcept { return m_weekdays[i]; } // note: Monday = 0
+				unsigned int hour   (std::size_t i) const noexcept { return m_hours   [i]; } // note: session bucket
+				unsigned int day    (std::size_t i) const noexcept { return m_days    [i]; }
+				unsigned int month  (std::size_t i) const noexcept { return m_months  [i]; }
+				unsigned int year   (std::size_t i) const noexcept { return m_years   [i]; }
+
+				std::size_t ordinal(std::size_t i) const noexcept // note: trading day of chart, from 0
+				{
+					return m_ordinals[i];
+				}
+
+				timestamp_t timestamp(std::size_t i) const noexcept
+				{
+					return m_timestamps[i];
+				}
+
+				const years_container_t & years() const noexcept
+				{
+					return m_year_ranges;
+				}
+
+				range_t rows(unsigned int year) const noexcept; // note: empty range if absent
+
+				std::size_t first_row(unsigned int year) const noexcept; // note: first row of year or later
+
+				range_t rows_before(unsigned int year) const noexcept
+				{
+					return range_t(0U, first_row(year));
+				}
+
+				range_t rows_since(unsigned int year) const noexcept
+				{
+					return range_t(first_row(year), size());
+				}
+
+				range_t rows(timestamp_t from, timestamp_t to) const noexcept; // note: timestamps [from, to)
+
+				range_t last_rows(std::size_t n) const noexcept
+				{
+					return range_t(size() - std::min(n, size()), size());
+				}
+
+				template < typename Container >
+				static auto view(const Container & container, range_t rows) // note: rows of a container of the same chart
+				{
+					return boost::make_iterator_range(
+						std::next(std::begin(container), rows.first),
+						std::next(std::begin(container), rows.second));
+				}
+
+			public:
+
+				static unsigned int weekday(const Date_Time & date_time) noexcept;
+
+			private:
+
+				std::vector < std::uint8_t  > m_weekdays;
+				std::vector < std::uint8_t  > m_hours;
+				std::vector < std::uint8_t  > m_days;
+				std::vector < std::uint8_t  > m_months;
+				std::vector < std::uint16_t > m_years;
+
+				std::vector < std::uint32_t > m_ordinals;
+
+				std::vector < timestamp_t > m_timestamps; // note: sorted
+
+				years_container_t m_year_ranges; // note: sorted by year
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_CALENDAR_HPP
\ No newline at end of file
@@ -19,6 +19,25 @@ namespace solution
 				return std::mktime(&time);
 			}
 
+			Date_Time::timestamp_t Date_Time::to_timestamp() const noexcept
+			{
+				const auto y = static_cast < timestamp_t > (year) - (month <= 2U ? 1 : 0);
+				const auto m = static_cast < timestamp_t > (month);
+
+				const auto era = (y >= 0 ? y : y - 399) / 400;
+
+				const auto year_of_era = y - era * 400;
+				const auto day_of_year = (153 * (m > 2 ? m - 3 : m + 9) + 2) / 5 + static_cast < timestamp_t > (day) - 1;
+				const auto day_of_era  = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+
+				const auto days = era * 146097 + day_of_era - 719468;
+
+				return (days * 86400 +
+					static_cast < timestamp_t > (hour)   * 3600 +
+					static_cast < timestamp_t > (minute) * 60 +
+					static_cast < timestamp_t > (second));
+			}
+
 			bool operator== (const Date_Time & lhs, const Date_Time & rhs)
 			{
 				return (
@@ -72,16 +91,60 @@ namespace solution
 				return (date_time_1.to_time_t() - date_time_2.to_time_t());
 			}
 
+			std::size_t Points::count_before(timestamp_t timestamp) const
+			{
+				if (empty())
+				{
+					return 0U;
+				}
+
+				auto first = std::next(std::begin(*m_arena), m_first);
+				auto last  = std::next(std::begin(*m_arena), m_last);
+
+				return std::distance(first, std::upper_bound(first, last, timestamp - 1)); // note: strictly before
+			}
+
 			std::size_t Level::strength_to_date(const date_time_t & date) const
 			{
-				return std::count_if(std::begin(strength_points), std::end(strength_points),
-					[&date](const auto & strength_point) { return (strength_point < date); });
+				return strength_points.count_before(date.to_timestamp());
 			}
 
 			std::size_t Level::weakness_to_date(const date_time_t & date) const
 			{
-				return std::count_if(std::begin(weakness_points), std::end(weakness_points),
-					[&date](const auto & weakness_point) { return (weakness_point < date); });
+				return weakness_points.count_before(date.to_timestamp());
+			}
+
+			void Level::make_points(std::vector < Level > & levels,
+				const raw_points_container_t & strength_points,
+				const raw_points_container_t & weakness_points)
+			{
+				auto arena = std::make_shared < Points::arena_t > ();
+
+				std::size_t size = 0U;
+
+				for (auto i = 0U; i < std::size(levels); ++i)
+				{
+					size += std::size(strength_points[i]) + std::size(weakness_points[i]);
+				}
+
+				arena->reserve(size);
+
+				auto append = [&arena](const auto & raw_points)
+				{
+					auto first = std::size(*arena);
+
+					arena->insert(std::end(*arena), std::begin(raw_points), std::end(raw_points));
+
+					std::sort(std::next(std::begin(*arena), first), std::end(*arena));
+
+					return Points(arena, first, std::size(*arena));
+				};
+
+				for (auto i = 0U; i < std::size(levels); ++i)
+				{
+					levels[i].strength_points = append(strength_points[i]);
+					levels[i].weakness_points = append(weakness_points[i]);
+				}
 			}
 
 			std::ostream & operator<< (std::ostream & stream, const Level & level)
@@ -104,6 +167,79 @@ namespace solution
 				return stream;
 			}
 
+			std::ostream & operator<< (std::ostream & stream, Candle::Classification_Tag classification_tag)
+			{
+				switch (classification_tag)
+				{
+				case Candle::Classification_Tag::OL:
+				{
+					stream << "OL";
+
+					break;
+				}
+				case Candle::Classification_Tag::CL:
+				{
+					stream << "CL";
+
+					break;
+				}
+				case Candle::Classification_Tag::OS:
+				{
+					stream << "OS";
+
+					break;
+				}
+				case Candle::Classification_Tag::CS:
+				{
+					stream << "CS";
+
+					break;
+				}
+				case Candle::Classification_Tag::CSOL:
+				{
+					stream << "CSOL";
+
+					break;
+				}
+				case Candle::Classification_Tag::CLOS:
+				{
+					stream << "CLOS";
+
+					break;
+				}
+				case Candle::Classification_Tag::mixed:
+				{
+					stream << "mixed";
+
+					break;
+				}
+				case Candle::Classification_Tag::L:
+				{
+					stream << "L";
+
+					break;
+				}
+				case Candle::Classification_Tag::S:
+				{
+					stream << "S";
+
+					break;
+				}
+				case Candle::Classification_Tag::C:
+				{
+					stream << "C";
+
+					break;
+				}
+				default:
+				{
+					break;
+				}
+				}
+
+				return stream;
+			}
+
 			void Candle::update_date_time() noexcept
 			{
 				date_time.year   = (raw_date / 100U) / 100U;
@@ -8,11 +8,13 @@
 #endif // #ifdef BOOST_HAS_PRAGMA_ONCE
 
 #include <algorithm>
-#include <array>
+#include <cstdint>
 #include <ctime>
 #include <iomanip>
+#include <memory>
 #include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace solution
@@ -23,10 +25,16 @@ namespace solution
 		{
 			struct Date_Time
 			{
+			public:
+
+				using timestamp_t = std::int64_t;
+
 			public:
 
 				std::time_t to_time_t() const noexcept;
 
+				timestamp_t to_timestamp() const noexcept; // note: seconds since 1970/01/01 without time zones
+
 			public:
 
 				unsigned int year   = 0U;
@@ -49,19 +57,77 @@ namespace solution
 
 			std::time_t duration(const Date_Time & date_time_1, const Date_Time & date_time_2);
 
+			class Points // note: sorted timestamps, a range in the arena shared by levels of an asset
+			{
+			public:
+
+				using timestamp_t = Date_Time::timestamp_t;
+
+				using arena_t = std::vector < timestamp_t > ;
+
+			public:
+
+				Points() = default;
+
+				Points(std::shared_ptr < const arena_t > arena, std::size_t first, std::size_t last) noexcept :
+					m_arena(std::move(arena)), m_first(first), m_last(last)
+				{}
+
+				~Points() noexcept = default;
+
+			public:
+
+				std::size_t size() const noexcept
+				{
+					return (m_last - m_first);
+				}
+
+				bool empty() const noexcept
+				{
+					return (m_first == m_last);
+				}
+
+				const timestamp_t * begin() const noexcept
+				{
+					return (empty() ? nullptr : m_arena->data() + m_first);
+				}
+
+				const timestamp_t * end() const noexcept
+				{
+					return (empty() ? nullptr : m_arena->data() + m_last);
+				}
+
+				std::size_t count_before(timestamp_t timestamp) const;
+
+			private:
+
+				std::shared_ptr < const arena_t > m_arena;
+
+				std::size_t m_first = 0U;
+				std::size_t m_last  = 0U;
+			};
+
 			struct Level
 			{
 			public:
 
 				using date_time_t = Date_Time;
 
-				using points_container_t = std::vector < date_time_t > ;
+				using points_container_t = Points;
+
+				using raw_points_container_t = std::vector < Points::arena_t > ;
 
 			public:
 
 				std::size_t strength_to_date(const date_time_t & date) const;
 				std::size_t weakness_to_date(const date_time_t & date) const;
 
+			public:
+
+				static void make_points(std::vector < Level > & levels,
+					const raw_points_container_t & strength_points,
+					const raw_points_container_t & weakness_points);
+
 			public:
 
 				date_time_t begin;
@@ -100,13 +166,27 @@ namespace solution
 					empty
 				};
 
-			public:
+				enum class Classification_Tag : std::uint8_t
+				{
+					empty,
 
-				void update_date_time() noexcept;
+					OL, // note: open long
+					CL, // note: close long
+					OS, // note: open short
+					CS, // note: close short
+
+					CSOL,
+					CLOS,
+					mixed,
+
+					L, // note: state long
+					S, // note: state short
+					C  // note: state closed
+				};
 
 			public:
 
-				static inline const std::size_t prediction_range = 10U;
+				void update_date_time() noexcept;
 
 			public:
 
@@ -129,9 +209,9 @@ namespace solution
 
 				double volume_deviation = 0.0;
 
-				std::array < double, prediction_range > regression_tags;
+				std::vector < double > regression_tags; // note: forward returns, horizons 1..regression_horizons
 
-				std::string classification_tag;
+				Classification_Tag classification_tag = Classification_Tag::empty;
 
 				int movement_tag = 0;
 
@@ -145,6 +225,8 @@ namespace solution
 				Type type = Type::empty;
 			};
 
+			std::ostream & operator<< (std::ostream & stream, Candle::Classification_Tag classification_tag);
+
 		} // namespace market
 
 	} // namespace system
@@ -0,0 +1,92 @@
+#include "dataflow.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			Dataflow::node_t Dataflow::add(task_t task, const nodes_container_t & dependencies)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto node = std::size(m_nodes);
+
+					for (auto dependency : dependencies)
+					{
+						if (dependency >= node) // note: dependencies before dependents, no cycles
+						{
+							throw std::invalid_argument("node " + std::to_string(dependency) + " not found");
+						}
+
+						m_nodes[dependency]->successors.push_back(node);
+					}
+
+					m_nodes.push_back(std::make_unique < Node > ());
+
+					m_nodes.back()->task = std::move(task);
+
+					m_nodes.back()->n_dependencies = std::size(dependencies);
+
+					return node;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < dataflow_exception > (logger, exception);
+				}
+			}
+
+			void Dataflow::run()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					nodes_container_t roots; // note: counters are decremented as soon as the first node is posted
+
+					for (auto node = 0U; node < std::size(m_nodes); ++node)
+					{
+						if (m_nodes[node]->n_dependencies == 0U)
+						{
+							roots.push_back(node);
+						}
+					}
+
+					Task_Group group(m_executor);
+
+					for (auto root : roots)
+					{
+						post(group, root);
+					}
+
+					group.get();
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < dataflow_exception > (logger, exception);
+				}
+			}
+
+			void Dataflow::post(Task_Group & group, node_t node)
+			{
+				group.run([this, &group, node]()
+					{
+						m_nodes[node]->task(); // note: successors of failed node are not posted
+
+						for (auto successor : m_nodes[node]->successors)
+						{
+							if (--(m_nodes[successor]->n_dependencies) == 0U)
+							{
+								post(group, successor);
+							}
+						}
+					});
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
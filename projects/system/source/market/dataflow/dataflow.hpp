@@ -0,0 +1,97 @@
+#ifndef SOLUTION_SYSTEM_MARKET_DATAFLOW_HPP
+#define SOLUTION_SYSTEM_MARKET_DATAFLOW_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include "../executor/executor.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class dataflow_exception : public std::exception
+			{
+			public:
+
+				explicit dataflow_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit dataflow_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~dataflow_exception() noexcept = default;
+			};
+
+			class Dataflow : private boost::noncopyable // note: node is posted when its last dependency completes
+			{
+			public:
+
+				using task_t = std::function < void() > ;
+
+				using node_t = std::size_t;
+
+				using nodes_container_t = std::vector < node_t > ;
+
+			private:
+
+				struct Node
+				{
+					task_t task;
+
+					nodes_container_t successors;
+
+					std::atomic < std::size_t > n_dependencies = 0U;
+				};
+
+			public:
+
+				explicit Dataflow(Executor & executor) noexcept : m_executor(executor)
+				{}
+
+				~Dataflow() noexcept = default;
+
+			public:
+
+				node_t add(task_t task, const nodes_container_t & dependencies = nodes_container_t());
+
+				void run();
+
+			private:
+
+				void post(Task_Group & group, node_t node);
+
+			private:
+
+				Executor & m_executor;
+
+				std::vector < std::unique_ptr < Node > > m_nodes;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_DATAFLOW_HPP
\ No newline at end of file
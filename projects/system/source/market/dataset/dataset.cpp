@@ -0,0 +1,140 @@
+#include "dataset.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void Dataset::push_back(const Row & row)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (std::size(row.features) != std::size(m_feature_names) ||
+						std::size(row.regression_tags) != m_n_horizons)
+					{
+						throw std::invalid_argument("invalid row size");
+					}
+
+					auto & partition = m_partitions[static_cast < std::size_t > (row.is_test ? Split::test : Split::train)];
+
+					partition.timestamps.push_back(row.timestamp);
+
+					partition.assets.push_back(row.asset);
+					partition.scales.push_back(row.scale);
+
+					partition.features.insert(std::end(partition.features),
+						std::begin(row.features), std::end(row.features));
+
+					partition.movement_tags.push_back(row.movement_tag);
+
+					partition.regression_tags.insert(std::end(partition.regression_tags),
+						std::begin(row.regression_tags), std::end(row.regression_tags));
+
+					partition.classification_tags.push_back(row.classification_tag);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < dataset_exception > (logger, exception);
+				}
+			}
+
+			void Dataset::save(const path_t & directory, const json_t & metadata) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					std::filesystem::create_directories(directory);
+
+					save_array(directory / File::timestamps_npy, "<i8", 0U, &Partition::timestamps);
+
+					save_array(directory / File::assets_npy, "<i4", 0U, &Partition::assets);
+					save_array(directory / File::scales_npy, "<i4", 0U, &Partition::scales);
+
+					save_array(directory / File::features_npy, "<f4", std::size(m_feature_names), &Partition::features);
+
+					save_array(directory / File::movement_tags_npy, "|i1", 0U, &Partition::movement_tags);
+
+					save_array(directory / File::regression_tags_npy, "<f4", m_n_horizons, &Partition::regression_tags);
+
+					save_array(directory / File::classification_tags_npy, "|u1", 0U, &Partition::classification_tags);
+
+					const auto n_train = size(Split::train);
+					const auto n_test  = size(Split::test);
+
+					auto object = metadata;
+
+					object["features"] = m_feature_names;
+
+					object["splits"]["train"] = std::vector < std::size_t > { 0U, n_train }; // note: [first, last) rows, views of mapped arrays
+					object["splits"]["test" ] = std::vector < std::size_t > { n_train, n_train + n_test };
+
+					const auto path = directory / File::dataset_data;
+
+					std::fstream fout(path.string(), std::ios::out | std::ios::trunc);
+
+					if (!fout)
+					{
+						throw dataset_exception("cannot open file " + path.string());
+					}
+
+					fout << std::setw(4) << object;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < dataset_exception > (logger, exception);
+				}
+			}
+
+			template < typename T >
+			void Dataset::save_array(const path_t & path, const std::string & descr,
+				std::size_t n_columns, std::vector < T > Partition:: * column) const
+			{
+				std::fstream fout(path.string(), std::ios::out | std::ios::trunc | std::ios::binary);
+
+				if (!fout)
+				{
+					throw dataset_exception("cannot open file " + path.string());
+				}
+
+				const auto n_rows = size(Split::train) + size(Split::test);
+
+				auto header = "{'descr': '" + descr + "', 'fortran_order': False, 'shape': (" + std::to_string(n_rows) +
+					(n_columns == 0U ? std::string(",") : ", " + std::to_string(n_columns)) + "), }";
+
+				const auto prefix_size = 10U; // note: magic, version and header size, NPY format 1.0
+
+				header.append((alignment - (prefix_size + std::size(header) + 1U) % alignment) % alignment, ' ').push_back('\n');
+
+				const auto header_size = static_cast < std::uint16_t > (std::size(header));
+
+				fout.write("\x93NUMPY\x01\x00", 8U);
+
+				const char header_size_bytes[] = { // note: little-endian
+					static_cast < char > (header_size & 0xFFU), static_cast < char > (header_size >> 8U) };
+
+				fout.write(header_size_bytes, 2U);
+
+				fout.write(header.data(), std::size(header));
+
+				for (const auto & partition : m_partitions) // note: little-endian host
+				{
+					const auto & values = partition.*column;
+
+					fout.write(reinterpret_cast < const char * > (values.data()), std::size(values) * sizeof(T));
+				}
+
+				if (!fout)
+				{
+					throw dataset_exception("cannot write file " + path.string());
+				}
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,162 @@
+#ifndef SOLUTION_SYSTEM_MARKET_DATASET_HPP
+#define SOLUTION_SYSTEM_MARKET_DATASET_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "../candle/candle.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class dataset_exception : public std::exception
+			{
+			public:
+
+				explicit dataset_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit dataset_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~dataset_exception() noexcept = default;
+			};
+
+			class Dataset // note: NPY arrays in one directory, train rows first, then test rows
+			{
+			public:
+
+				using path_t = std::filesystem::path;
+
+				using json_t = nlohmann::json;
+
+				using timestamp_t = Date_Time::timestamp_t;
+
+				using names_container_t = std::vector < std::string > ;
+
+			public:
+
+				struct Row // note: reused by callers, features and regression tags are cleared
+				{
+					bool is_test = false;
+
+					timestamp_t timestamp = 0LL;
+
+					std::int32_t asset = 0;
+					std::int32_t scale = 0;
+
+					std::vector < float > features;
+
+					std::int8_t movement_tag = 0;
+
+					std::vector < float > regression_tags;
+
+					std::uint8_t classification_tag = 0U;
+				};
+
+			private:
+
+				struct Partition
+				{
+					std::vector < timestamp_t > timestamps;
+
+					std::vector < std::int32_t > assets;
+					std::vector < std::int32_t > scales;
+
+					std::vector < float > features;
+
+					std::vector < std::int8_t > movement_tags;
+
+					std::vector < float > regression_tags;
+
+					std::vector < std::uint8_t > classification_tags;
+				};
+
+				enum class Split : std::size_t
+				{
+					train,
+					test,
+
+					size
+				};
+
+			public:
+
+				explicit Dataset(const names_container_t & feature_names, std::size_t n_horizons) :
+					m_feature_names(feature_names), m_n_horizons(n_horizons)
+				{}
+
+				~Dataset() noexcept = default;
+
+			public:
+
+				void push_back(const Row & row);
+
+				void save(const path_t & directory, const json_t & metadata) const;
+
+			private:
+
+				template < typename T >
+				void save_array(const path_t & path, const std::string & descr,
+					std::size_t n_columns, std::vector < T > Partition:: * column) const;
+
+				std::size_t size(Split split) const noexcept
+				{
+					return std::size(m_partitions[static_cast < std::size_t > (split)].timestamps);
+				}
+
+			private:
+
+				struct File
+				{
+					static inline const path_t timestamps_npy          = "timestamps.npy";
+					static inline const path_t assets_npy              = "assets.npy";
+					static inline const path_t scales_npy              = "scales.npy";
+					static inline const path_t features_npy            = "features.npy";
+					static inline const path_t movement_tags_npy       = "movement_tags.npy";
+					static inline const path_t regression_tags_npy     = "regression_tags.npy";
+					static inline const path_t classification_tags_npy = "classification_tags.npy";
+					static inline const path_t dataset_data            = "dataset.data";
+				};
+
+				static inline const std::size_t alignment = 64U; // note: NPY header with padding
+
+			private:
+
+				const names_container_t m_feature_names;
+
+				const std::size_t m_n_horizons;
+
+				std::array < Partition, static_cast < std::size_t > (Split::size) > m_partitions;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_DATASET_HPP
\ No newline at end of file
@@ -0,0 +1,94 @@
+#include "detector.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			Detector::radii_container_t Detector::make_min_radii(const values_container_t & values)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					return make_radii(values, std::greater < double > (), std::greater_equal < double > ()); // note: first minimum
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < detector_exception > (logger, exception);
+				}
+			}
+
+			Detector::radii_container_t Detector::make_max_radii(const values_container_t & values)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					return make_radii(values, std::less_equal < double > (), std::less < double > ()); // note: last maximum
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < detector_exception > (logger, exception);
+				}
+			}
+
+			template < typename Left_Compare, typename Right_Compare >
+			Detector::radii_container_t Detector::make_radii(const values_container_t & values,
+				Left_Compare left_compare, Right_Compare right_compare)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto size = std::size(values);
+
+					radii_container_t radii(size, 0U);
+
+					indexes_container_t stack;
+
+					stack.reserve(size);
+
+					for (auto i = 0U; i < size; ++i)
+					{
+						while (!std::empty(stack) && left_compare(values[stack.back()], values[i]))
+						{
+							stack.pop_back();
+						}
+
+						radii[i] = (std::empty(stack) ? i : i - stack.back() - 1U);
+
+						stack.push_back(i);
+					}
+
+					stack.clear();
+
+					for (auto i = size; i > 0U; --i)
+					{
+						const auto index = i - 1U;
+
+						while (!std::empty(stack) && right_compare(values[stack.back()], values[index]))
+						{
+							stack.pop_back();
+						}
+
+						radii[index] = std::min(radii[index], (std::empty(stack) ?
+							size - 1U - index : stack.back() - index - 1U));
+
+						stack.push_back(index);
+					}
+
+					return radii;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < detector_exception > (logger, exception);
+				}
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,72 @@
+#ifndef SOLUTION_SYSTEM_MARKET_DETECTOR_HPP
+#define SOLUTION_SYSTEM_MARKET_DETECTOR_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class detector_exception : public std::exception
+			{
+			public:
+
+				explicit detector_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit detector_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~detector_exception() noexcept = default;
+			};
+
+			class Detector // note: largest radii of local extrema, nearest blockers via monotonic stacks
+			{
+			public:
+
+				using values_container_t = std::vector < double > ;
+
+				using radii_container_t = std::vector < std::size_t > ;
+
+			private:
+
+				using indexes_container_t = std::vector < std::size_t > ;
+
+			public:
+
+				static radii_container_t make_min_radii(const values_container_t & values);
+
+				static radii_container_t make_max_radii(const values_container_t & values);
+
+			private:
+
+				template < typename Left_Compare, typename Right_Compare >
+				static radii_container_t make_radii(const values_container_t & values,
+					Left_Compare left_compare, Right_Compare right_compare);
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_DETECTOR_HPP
\ No newline at end of file
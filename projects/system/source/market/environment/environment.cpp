@@ -0,0 +1,142 @@
+#include "environment.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void Environment::initialize()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto n_rows = size();
+
+					m_features.resize(n_rows * m_n_features, feature_t(0));
+
+					m_assets.resize(n_rows, 0U);
+
+					m_timestamps.resize(n_rows, 0LL);
+
+					m_directions.resize(n_rows, 0);
+
+					m_deviations.resize(n_rows, 0.0F);
+
+					m_next_test = m_n_train;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < environment_exception > (logger, exception);
+				}
+			}
+
+			std::size_t Environment::insert(bool is_test, asset_id_t asset, timestamp_t timestamp, int direction, double deviation)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					auto & next = (is_test ? m_next_test : m_next_train);
+
+					if (next == (is_test ? size() : m_n_train))
+					{
+						throw std::out_of_range("partition is full");
+					}
+
+					const auto row = next++;
+
+					m_assets    [row] = asset;
+					m_timestamps[row] = timestamp;
+					m_directions[row] = static_cast < std::int8_t > (direction);
+					m_deviations[row] = static_cast < float > (deviation);
+
+					return row;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < environment_exception > (logger, exception);
+				}
+			}
+
+			Environment::asset_id_t Environment::intern(const std::string & asset)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					auto [iterator, is_inserted] = m_asset_ids.emplace(asset,
+						static_cast < asset_id_t > (std::size(m_asset_names)));
+
+					if (is_inserted)
+					{
+						m_asset_names.push_back(asset);
+					}
+
+					return iterator->second;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < environment_exception > (logger, exception);
+				}
+			}
+
+			void Environment::sort()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					std::vector < std::size_t > order(size());
+
+					std::iota(std::begin(order), std::end(order), 0U);
+
+					const auto less = [this](auto lhs, auto rhs) { return (m_timestamps[lhs] < m_timestamps[rhs]); };
+
+					std::stable_sort(std::begin(order), std::next(std::begin(order), m_n_train), less);
+					std::stable_sort(std::next(std::begin(order), m_n_train), std::end(order), less);
+
+					std::vector < feature_t > sorted_features(std::size(m_features));
+
+					std::vector < asset_id_t > sorted_assets(size());
+
+					std::vector < timestamp_t > sorted_timestamps(size());
+
+					std::vector < std::int8_t > sorted_directions(size());
+
+					std::vector < float > sorted_deviations(size());
+
+					for (auto row = 0U; row < size(); ++row)
+					{
+						const auto source = order[row];
+
+						std::copy(features(source), features(source) + m_n_features, sorted_features.data() + row * m_n_features);
+
+						sorted_assets    [row] = m_assets    [source];
+						sorted_timestamps[row] = m_timestamps[source];
+						sorted_directions[row] = m_directions[source];
+						sorted_deviations[row] = m_deviations[source];
+					}
+
+					m_features.swap(sorted_features);
+
+					m_assets.swap(sorted_assets);
+
+					m_timestamps.swap(sorted_timestamps);
+
+					m_directions.swap(sorted_directions);
+
+					m_deviations.swap(sorted_deviations);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < environment_exception > (logger, exception);
+				}
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,213 @@
+#ifndef SOLUTION_SYSTEM_MARKET_ENVIRONMENT_HPP
+#define SOLUTION_SYSTEM_MARKET_ENVIRONMENT_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../candle/candle.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class environment_exception : public std::exception
+			{
+			public:
+
+				explicit environment_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit environment_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~environment_exception() noexcept = default;
+			};
+
+			class Environment // note: row-major features and label columns, train rows then test rows
+			{
+			public:
+
+				using feature_t = float;
+
+				using asset_id_t = std::uint32_t;
+
+				using timestamp_t = Date_Time::timestamp_t;
+
+			public:
+
+				class View // note: rows [first, last) of the environment, no copy
+				{
+				public:
+
+					View(const Environment & environment, std::size_t first, std::size_t last) noexcept :
+						m_environment(environment), m_first(first), m_last(last)
+					{}
+
+					~View() noexcept = default;
+
+				public:
+
+					std::size_t size() const noexcept
+					{
+						return (m_last - m_first);
+					}
+
+					bool empty() const noexcept
+					{
+						return (m_first == m_last);
+					}
+
+					std::size_t n_features() const noexcept
+					{
+						return m_environment.n_features();
+					}
+
+					const feature_t * features(std::size_t index) const noexcept
+					{
+						return m_environment.features(m_first + index);
+					}
+
+					asset_id_t asset(std::size_t index) const noexcept
+					{
+						return m_environment.m_assets[m_first + index];
+					}
+
+					timestamp_t timestamp(std::size_t index) const noexcept
+					{
+						return m_environment.m_timestamps[m_first + index];
+					}
+
+					const timestamp_t * timestamps() const noexcept
+					{
+						return (m_environment.m_timestamps.data() + m_first);
+					}
+
+					int direction(std::size_t index) const noexcept
+					{
+						return m_environment.m_directions[m_first + index];
+					}
+
+					double deviation(std::size_t index) const noexcept
+					{
+						return m_environment.m_deviations[m_first + index];
+					}
+
+				private:
+
+					const Environment & m_environment;
+
+					const std::size_t m_first;
+					const std::size_t m_last;
+				};
+
+			public:
+
+				Environment() = default;
+
+				explicit Environment(std::size_t n_train, std::size_t n_test, std::size_t n_features) :
+					m_n_train(n_train), m_n_test(n_test), m_n_features(n_features)
+				{
+					initialize();
+				}
+
+				~Environment() noexcept = default;
+
+			private:
+
+				void initialize();
+
+			public:
+
+				std::size_t insert(bool is_test, asset_id_t asset, timestamp_t timestamp, int direction, double deviation);
+
+				asset_id_t intern(const std::string & asset);
+
+				void sort(); // note: rows of each partition by timestamp, stable
+
+				const std::string & asset(asset_id_t asset) const
+				{
+					return m_asset_names.at(asset);
+				}
+
+			public:
+
+				std::size_t size() const noexcept
+				{
+					return (m_n_train + m_n_test);
+				}
+
+				std::size_t n_features() const noexcept
+				{
+					return m_n_features;
+				}
+
+				feature_t * features(std::size_t row) noexcept
+				{
+					return (m_features.data() + row * m_n_features);
+				}
+
+				const feature_t * features(std::size_t row) const noexcept
+				{
+					return (m_features.data() + row * m_n_features);
+				}
+
+				View train() const noexcept
+				{
+					return View(*this, 0U, m_n_train);
+				}
+
+				View test() const noexcept
+				{
+					return View(*this, m_n_train, m_n_train + m_n_test);
+				}
+
+			private:
+
+				std::size_t m_n_train    = 0U;
+				std::size_t m_n_test     = 0U;
+				std::size_t m_n_features = 0U;
+
+				std::size_t m_next_train = 0U; // note: next free row of partition
+				std::size_t m_next_test  = 0U;
+
+				std::vector < feature_t > m_features;
+
+				std::vector < asset_id_t > m_assets;
+
+				std::vector < timestamp_t > m_timestamps;
+
+				std::vector < std::int8_t > m_directions;
+
+				std::vector < float > m_deviations;
+
+				std::vector < std::string > m_asset_names;
+
+				std::unordered_map < std::string, asset_id_t > m_asset_ids;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_ENVIRONMENT_HPP
\ No newline at end of file
@@ -0,0 +1,416 @@
+#include "event_study.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void Event_Study::insert(const std::string & asset, const std::string & scale,
+				const candles_container_t & candles, const Calendar & calendar)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (std::size(calendar) != std::size(candles))
+					{
+						throw std::invalid_argument("calendar does not match chart " + asset + " " + scale);
+					}
+
+					Chart chart;
+
+					chart.asset = asset;
+					chart.scale = scale;
+
+					chart.calendar = &calendar;
+
+					const auto size = std::size(candles);
+
+					chart.opens .reserve(size);
+					chart.highs .reserve(size);
+					chart.lows  .reserve(size);
+					chart.closes.reserve(size);
+
+					for (const auto & candle : candles)
+					{
+						chart.opens .push_back(candle.price_open);
+						chart.highs .push_back(candle.price_high);
+						chart.lows  .push_back(candle.price_low);
+						chart.closes.push_back(candle.price_close);
+					}
+
+					m_charts.push_back(std::move(chart));
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < event_study_exception > (logger, exception);
+				}
+			}
+
+			Event_Study::results_container_t Event_Study::run(const Query & query) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (query.outcome.horizon == 0U)
+					{
+						throw std::domain_error("required horizon > 0");
+					}
+
+					std::vector < std::pair < const Chart *, std::pair < std::size_t, std::size_t > > > tasks;
+
+					for (const auto & chart : m_charts)
+					{
+						if (chart.scale == query.scale)
+						{
+							for (const auto & year : chart.calendar->years())
+							{
+								tasks.emplace_back(&chart, year.rows);
+							}
+						}
+					}
+
+					results_container_t results(std::size(tasks));
+
+					Task_Group group(m_executor);
+
+					for (auto t = 0U; t < std::size(tasks); ++t)
+					{
+						group.run([this, &query, &tasks, &results, t]()
+							{
+								const auto & chart = *tasks[t].first;
+
+								const auto [first, last] = tasks[t].second;
+
+								std::vector < mask_t > mask;
+
+								make_valid_mask(chart, query.outcome, first, last, mask);
+
+								for (const auto & condition : query.conditions)
+								{
+									make_mask(chart, condition, first, last, mask);
+								}
+
+								results[t] = Result { chart.asset, chart.calendar->year(first),
+									aggregate(chart, query.outcome, first, mask) };
+							});
+					}
+
+					group.get();
+
+					results.erase(std::remove_if(std::begin(results), std::end(results),
+						[](const auto & result) { return (result.statistics.n_events == 0U); }), std::end(results));
+
+					std::sort(std::begin(results), std::end(results), [](const auto & lhs, const auto & rhs)
+						{
+							return (lhs.asset < rhs.asset || (lhs.asset == rhs.asset && lhs.year < rhs.year));
+						});
+
+					return results;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < event_study_exception > (logger, exception);
+				}
+			}
+
+			Event_Study::samples_container_t Event_Study::samples(const Query & query, Measure measure) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (query.outcome.horizon == 0U)
+					{
+						throw std::domain_error("required horizon > 0");
+					}
+
+					std::vector < const Chart * > charts;
+
+					for (const auto & chart : m_charts)
+					{
+						if (chart.scale == query.scale)
+						{
+							charts.push_back(&chart);
+						}
+					}
+
+					samples_container_t samples(std::size(charts));
+
+					Task_Group group(m_executor);
+
+					for (auto c = 0U; c < std::size(charts); ++c)
+					{
+						group.run([this, &query, &charts, &samples, measure, c]()
+							{
+								const auto & chart = *charts[c];
+
+								auto & sample = samples[c];
+
+								sample.asset = chart.asset;
+
+								std::vector < mask_t > mask;
+
+								make_valid_mask(chart, query.outcome, 0U, std::size(chart.closes), mask);
+
+								for_each(mask, [this, &chart, &query, &sample, measure](auto i)
+									{
+										sample.population.push_back(evaluate(chart, query.outcome, measure, i));
+									});
+
+								for (const auto & condition : query.conditions)
+								{
+									make_mask(chart, condition, 0U, std::size(chart.closes), mask);
+								}
+
+								for_each(mask, [this, &chart, &query, &sample, measure](auto i)
+									{
+										sample.events.push_back(evaluate(chart, query.outcome, measure, i));
+									});
+							});
+					}
+
+					group.get();
+
+					std::sort(std::begin(samples), std::end(samples),
+						[](const auto & lhs, const auto & rhs) { return (lhs.asset < rhs.asset); });
+
+					return samples;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < event_study_exception > (logger, exception);
+				}
+			}
+
+			Event_Study::conditions_container_t Event_Study::parse(const std::string & conditions)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					static const std::regex regex_term(
+						R"(\s*([a-z_]+)\s*(?:\[\s*([+-]?\d+)\s*\])?\s*(==|!=|<=|>=|<|>)\s*([+-]?[0-9]*\.?[0-9]+(?:[eE][+-]?[0-9]+)?)\s*)");
+
+					static const std::vector < std::pair < std::string, Condition::Field > > fields =
+					{
+						{ "weekday",         Condition::Field::weekday         },
+						{ "hour",            Condition::Field::hour            },
+						{ "day",             Condition::Field::day             },
+						{ "month",           Condition::Field::month           },
+						{ "year",            Condition::Field::year            },
+						{ "deviation_open",  Condition::Field::deviation_open  },
+						{ "deviation_high",  Condition::Field::deviation_high  },
+						{ "deviation_low",   Condition::Field::deviation_low   },
+						{ "deviation_close", Condition::Field::deviation_close }
+					};
+
+					static const std::vector < std::pair < std::string, Condition::Relation > > relations =
+					{
+						{ "==", Condition::Relation::equal         },
+						{ "!=", Condition::Relation::not_equal     },
+						{ "<",  Condition::Relation::less          },
+						{ "<=", Condition::Relation::less_equal    },
+						{ ">",  Condition::Relation::greater       },
+						{ ">=", Condition::Relation::greater_equal }
+					};
+
+					conditions_container_t result;
+
+					if (conditions.find_first_not_of(" \t") == std::string::npos)
+					{
+						return result;
+					}
+
+					for (std::size_t first = 0U, last = 0U; first <= std::size(conditions); first = last + 2U)
+					{
+						last = std::min(conditions.find("&&", first), std::size(conditions));
+
+						const auto term = conditions.substr(first, last - first);
+
+						std::smatch match;
+
+						if (!std::regex_match(term, match, regex_term))
+						{
+							throw std::invalid_argument("invalid condition: " + term);
+						}
+
+						auto field = std::find_if(std::begin(fields), std::end(fields),
+							[&match](const auto & pair) { return (pair.first == match[1].str()); });
+
+						if (field == std::end(fields))
+						{
+							throw std::invalid_argument("unknown field: " + match[1].str());
+						}
+
+						Condition condition;
+
+						condition.field = field->second;
+
+						condition.relation = std::find_if(std::begin(relations), std::end(relations),
+							[&match](const auto & pair) { return (pair.first == match[3].str()); })->second;
+
+						condition.value = std::stod(match[4].str());
+
+						condition.offset = (match[2].matched ? std::stoll(match[2].str()) : 0LL);
+
+						result.push_back(condition);
+					}
+
+					return result;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < event_study_exception > (logger, exception);
+				}
+			}
+
+			void Event_Study::make_mask(const Chart & chart, const Condition & condition,
+				std::size_t first, std::size_t last, std::vector < mask_t > & mask) const
+			{
+				const auto size = static_cast < std::ptrdiff_t > (std::size(chart.closes));
+
+				const auto offset = static_cast < std::ptrdiff_t > (first) + condition.offset;
+
+				const auto is_deviation = (condition.field >= Condition::Field::deviation_open);
+
+				const auto min_index = (is_deviation ? 1 : 0);
+
+				const auto & calendar = *chart.calendar;
+
+				auto value = [&chart, &calendar, &condition](std::size_t j) -> double
+				{
+					switch (condition.field)
+					{
+					case Condition::Field::weekday: return calendar.weekday(j);
+					case Condition::Field::hour:    return calendar.hour(j);
+					case Condition::Field::day:     return calendar.day(j);
+					case Condition::Field::month:   return calendar.month(j);
+					case Condition::Field::year:    return calendar.year(j);
+
+					case Condition::Field::deviation_open:  return (chart.opens [j] - chart.closes[j - 1U]) / chart.closes[j - 1U];
+					case Condition::Field::deviation_high:  return (chart.highs [j] - chart.closes[j - 1U]) / chart.closes[j - 1U];
+					case Condition::Field::deviation_low:   return (chart.lows  [j] - chart.closes[j - 1U]) / chart.closes[j - 1U];
+					case Condition::Field::deviation_close: return (chart.closes[j] - chart.closes[j - 1U]) / chart.closes[j - 1U];
+
+					default: return 0.0;
+					}
+				};
+
+				auto compare = [&condition](double x)
+				{
+					switch (condition.relation)
+					{
+					case Condition::Relation::equal:         return (x == condition.value);
+					case Condition::Relation::not_equal:     return (x != condition.value);
+					case Condition::Relation::less:          return (x <  condition.value);
+					case Condition::Relation::less_equal:    return (x <= condition.value);
+					case Condition::Relation::greater:       return (x >  condition.value);
+					case Condition::Relation::greater_equal: return (x >= condition.value);
+
+					default: return false;
+					}
+				};
+
+				fill(mask, last - first, [offset, size, min_index, &value, &compare](auto k)
+					{
+						const auto j = offset + static_cast < std::ptrdiff_t > (k);
+
+						return (j >= min_index && j < size && compare(value(static_cast < std::size_t > (j))));
+					});
+			}
+
+			void Event_Study::make_valid_mask(const Chart & chart, const Outcome & outcome,
+				std::size_t first, std::size_t last, std::vector < mask_t > & mask) const
+			{
+				const auto horizon = outcome.horizon;
+
+				const auto size = std::size(chart.closes);
+
+				mask.assign((last - first + bits - 1U) / bits, ~mask_t(0U));
+
+				fill(mask, last - first, [first, horizon, size](auto k) // note: previous close and horizon exist
+					{
+						return (first + k >= 1U && first + k + horizon <= size);
+					});
+			}
+
+			Event_Study::Statistics Event_Study::aggregate(const Chart & chart, const Outcome & outcome,
+				std::size_t first, const std::vector < mask_t > & mask) const
+			{
+				Statistics statistics;
+
+				auto sum_squares = 0.0;
+
+				for_each(mask, [&chart, &outcome, &statistics, &sum_squares, first](auto k)
+					{
+						const auto i = first + k;
+
+						const auto previous_price = chart.closes[i - 1U];
+
+						const auto norm = (outcome.is_relative ? previous_price : 1.0);
+
+						const auto high = *std::max_element(
+							std::next(std::begin(chart.highs), i), std::next(std::begin(chart.highs), i + outcome.horizon));
+						const auto low  = *std::min_element(
+							std::next(std::begin(chart.lows),  i), std::next(std::begin(chart.lows),  i + outcome.horizon));
+
+						const auto has_L = ((high - previous_price) / norm >  outcome.threshold);
+						const auto has_S = ((low  - previous_price) / norm < -outcome.threshold);
+
+						statistics.n_L    += has_L;
+						statistics.n_S    += has_S;
+						statistics.n_both += (has_L && has_S);
+
+						const auto x = (chart.closes[i + outcome.horizon - 1U] - previous_price) / norm;
+
+						statistics.n_positive += (x > 0.0);
+
+						const auto delta = x - statistics.mean; // note: Welford
+
+						statistics.mean += delta / (++statistics.n_events);
+
+						sum_squares += delta * (x - statistics.mean);
+					});
+
+				statistics.sd = (statistics.n_events > 1U ? std::sqrt(sum_squares / (statistics.n_events - 1U)) : 0.0);
+
+				return statistics;
+			}
+
+			double Event_Study::evaluate(const Chart & chart, const Outcome & outcome, Measure measure, std::size_t i) const
+			{
+				const auto previous_price = chart.closes[i - 1U];
+
+				const auto norm = (outcome.is_relative ? previous_price : 1.0);
+
+				if (measure == Measure::close_return)
+				{
+					return (chart.closes[i + outcome.horizon - 1U] - previous_price) / norm;
+				}
+
+				const auto high = *std::max_element(
+					std::next(std::begin(chart.highs), i), std::next(std::begin(chart.highs), i + outcome.horizon));
+				const auto low  = *std::min_element(
+					std::next(std::begin(chart.lows),  i), std::next(std::begin(chart.lows),  i + outcome.horizon));
+
+				const auto has_L = ((high - previous_price) / norm >  outcome.threshold);
+				const auto has_S = ((low  - previous_price) / norm < -outcome.threshold);
+
+				switch (measure)
+				{
+				case Measure::L:    return (has_L ? 1.0 : 0.0);
+				case Measure::S:    return (has_S ? 1.0 : 0.0);
+				case Measure::both: return ((has_L && has_S) ? 1.0 : 0.0);
+
+				default: return 0.0;
+				}
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,259 @@
+#ifndef SOLUTION_SYSTEM_MARKET_EVENT_STUDY_HPP
+#define SOLUTION_SYSTEM_MARKET_EVENT_STUDY_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <regex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../calendar/calendar.hpp"
+#include "../candle/candle.hpp"
+#include "../executor/executor.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class event_study_exception : public std::exception
+			{
+			public:
+
+				explicit event_study_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit event_study_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~event_study_exception() noexcept = default;
+			};
+
+			class Event_Study // note: conditions as bitmask columns over charts, outcomes from previous close
+			{
+			public:
+
+				using candles_container_t = std::vector < Candle > ;
+
+				using mask_t = std::uint64_t;
+
+				struct Condition // note: field of candle i + offset compared with value
+				{
+					enum class Field
+					{
+						weekday, // note: Monday = 0
+						hour,
+						day,
+						month,
+						year,
+
+						deviation_open, // note: relative to previous close
+						deviation_high,
+						deviation_low,
+						deviation_close
+					};
+
+					enum class Relation
+					{
+						equal,
+						not_equal,
+						less,
+						less_equal,
+						greater,
+						greater_equal
+					};
+
+					Field field = Field::weekday;
+
+					Relation relation = Relation::equal;
+
+					double value = 0.0;
+
+					std::ptrdiff_t offset = 0;
+				};
+
+				using conditions_container_t = std::vector < Condition > ;
+
+				struct Outcome // note: candles i, ..., i + horizon - 1 against close of i - 1
+				{
+					std::size_t horizon = 1U;
+
+					double threshold = 0.0;
+
+					bool is_relative = true; // note: threshold and returns divided by previous close
+				};
+
+				enum class Measure // note: value of one event for samples
+				{
+					close_return,
+
+					L,
+					S,
+					both
+				};
+
+				struct Query
+				{
+					std::string scale;
+
+					conditions_container_t conditions;
+
+					Outcome outcome;
+				};
+
+				struct Statistics
+				{
+					std::size_t n_events = 0U;
+
+					std::size_t n_L    = 0U; // note: max high above +threshold
+					std::size_t n_S    = 0U; // note: min low below -threshold
+					std::size_t n_both = 0U;
+
+					std::size_t n_positive = 0U; // note: by return of last close
+
+					double mean = 0.0;
+					double sd   = 0.0;
+				};
+
+				struct Result
+				{
+					std::string asset;
+
+					unsigned int year = 0U;
+
+					Statistics statistics;
+				};
+
+				using results_container_t = std::vector < Result > ;
+
+				struct Sample
+				{
+					std::string asset;
+
+					std::vector < double > events;
+
+					std::vector < double > population; // note: all candles with previous close and horizon
+				};
+
+				using samples_container_t = std::vector < Sample > ;
+
+			private:
+
+				struct Chart // note: columns of one asset and scale
+				{
+					std::string asset;
+					std::string scale;
+
+					const Calendar * calendar = nullptr; // note: owned by caller, outlives the study
+
+					std::vector < double > opens;
+					std::vector < double > highs;
+					std::vector < double > lows;
+					std::vector < double > closes;
+				};
+
+			public:
+
+				explicit Event_Study(Executor & executor) noexcept : m_executor(executor)
+				{}
+
+				~Event_Study() noexcept = default;
+
+			public:
+
+				void insert(const std::string & asset, const std::string & scale,
+					const candles_container_t & candles, const Calendar & calendar);
+
+				results_container_t run(const Query & query) const;
+
+				samples_container_t samples(const Query & query, Measure measure) const; // note: one per asset, all years
+
+			public:
+
+				static conditions_container_t parse(const std::string & conditions); // note: "weekday[-1] == 3 && hour == 10"
+
+			private:
+
+				void make_mask(const Chart & chart, const Condition & condition,
+					std::size_t first, std::size_t last, std::vector < mask_t > & mask) const;
+
+				void make_valid_mask(const Chart & chart, const Outcome & outcome,
+					std::size_t first, std::size_t last, std::vector < mask_t > & mask) const;
+
+				Statistics aggregate(const Chart & chart, const Outcome & outcome,
+					std::size_t first, const std::vector < mask_t > & mask) const;
+
+				double evaluate(const Chart & chart, const Outcome & outcome, Measure measure, std::size_t i) const;
+
+				template < typename F >
+				static void for_each(const std::vector < mask_t > & mask, F && function)
+				{
+					for (auto w = 0U; w < std::size(mask); ++w)
+					{
+						for (auto word = mask[w]; word != 0U; word &= (word - 1U))
+						{
+							auto b = 0U;
+
+							while (((word >> b) & 1U) == 0U)
+							{
+								++b;
+							}
+
+							function(w * bits + b);
+						}
+					}
+				}
+
+				template < typename F >
+				static void fill(std::vector < mask_t > & mask, std::size_t size, F && predicate)
+				{
+					for (auto w = 0U; w < std::size(mask); ++w) // note: branchless inner loop, vectorizable
+					{
+						const auto first = w * bits;
+						const auto last  = std::min(first + bits, size);
+
+						mask_t word = 0U;
+
+						for (auto i = first; i < last; ++i)
+						{
+							word |= (static_cast < mask_t > (predicate(i)) << (i - first));
+						}
+
+						mask[w] &= word;
+					}
+				}
+
+			private:
+
+				static inline const std::size_t bits = 64U;
+
+			private:
+
+				Executor & m_executor;
+
+				std::vector < Chart > m_charts;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_EVENT_STUDY_HPP
\ No newline at end of file
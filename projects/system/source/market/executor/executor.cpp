@@ -0,0 +1,432 @@
+#include "executor.hpp"
+
+#if defined(_WIN32)
+#  ifndef NOMINMAX
+#    define NOMINMAX
+#  endif // #ifndef NOMINMAX
+#  include <windows.h>
+#elif defined(__linux__)
+#  include <pthread.h>
+#  include <sched.h>
+#endif // #if defined(_WIN32)
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			Executor & Executor::instance()
+			{
+				return storage(nullptr);
+			}
+
+			Executor & Executor::instance(const Parameters & parameters)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					auto & executor = storage(&parameters);
+
+					if (parameters.size_policy(get_n_processors()) != executor.size() ||
+						parameters.required_affinity != executor.m_parameters.required_affinity ||
+						parameters.required_numa     != executor.m_parameters.required_numa)
+					{
+						throw std::logic_error("required: same parameters for existing executor");
+					}
+
+					return executor;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < executor_exception > (logger, exception);
+				}
+			}
+
+			Executor & Executor::storage(const Parameters * parameters)
+			{
+				static Executor executor(parameters ? *parameters : Parameters());
+
+				return executor;
+			}
+
+			std::size_t Executor::get_n_processors() noexcept
+			{
+				return std::max(std::thread::hardware_concurrency(), 1U);
+			}
+
+			void Executor::initialize()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto n_processors = get_n_processors();
+
+					const auto size = m_parameters.size_policy(n_processors);
+
+					if (size == 0U)
+					{
+						throw std::domain_error("required: (size > 0)");
+					}
+
+					m_workers.reserve(size);
+
+					for (auto i = 0U; i < size; ++i)
+					{
+						m_workers.push_back(std::make_unique < Worker > ());
+					}
+
+					place_workers();
+
+					m_threads.reserve(size);
+
+					for (auto i = 0U; i < size; ++i)
+					{
+						m_threads.emplace_back([this, i]() { run(i); });
+
+						if (m_parameters.required_affinity)
+						{
+							set_affinity(m_threads.back(), m_workers[i]->processor);
+						}
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < executor_exception > (logger, exception);
+				}
+			}
+
+			void Executor::uninitialize()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					{
+						std::scoped_lock lock(m_mutex);
+
+						m_is_stopped = true;
+					}
+
+					m_condition.notify_all();
+
+					for (auto & thread : m_threads)
+					{
+						if (thread.joinable())
+						{
+							thread.join();
+						}
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < executor_exception > (logger, exception);
+				}
+			}
+
+			void Executor::place_workers()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto n_processors = get_n_processors();
+
+					std::vector < std::pair < std::size_t, std::size_t > > processors; // (node, processor)
+
+					processors.reserve(n_processors);
+
+					for (auto processor = 0U; processor < n_processors; ++processor)
+					{
+						processors.emplace_back(m_parameters.required_numa ? get_node(processor) : 0U, processor);
+					}
+
+					std::stable_sort(std::begin(processors), std::end(processors),
+						[](const auto & lhs, const auto & rhs) { return (lhs.first < rhs.first); });
+
+					for (auto i = 0U; i < std::size(m_workers); ++i)
+					{
+						const auto & [node, processor] = processors[i % n_processors];
+
+						m_workers[i]->node      = node;
+						m_workers[i]->processor = processor;
+					}
+
+					for (auto i = 0U; i < std::size(m_workers); ++i)
+					{
+						auto & victims = m_workers[i]->victims;
+
+						for (auto j = 1U; j < std::size(m_workers); ++j)
+						{
+							victims.push_back((i + j) % std::size(m_workers));
+						}
+
+						std::stable_partition(std::begin(victims), std::end(victims), [this, i](auto victim)
+							{ return (m_workers[victim]->node == m_workers[i]->node); });
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < executor_exception > (logger, exception);
+				}
+			}
+
+			void Executor::run(std::size_t index)
+			{
+				current_executor = this;
+				current_index    = index;
+
+				task_t task;
+
+				while (true)
+				{
+					if (pop(index, task))
+					{
+						execute(task);
+					}
+					else
+					{
+						std::unique_lock lock(m_mutex);
+
+						m_condition.wait(lock, [this]() { return (m_is_stopped || m_pending > 0U); });
+
+						if (m_is_stopped)
+						{
+							break;
+						}
+					}
+				}
+			}
+
+			void Executor::post(task_t task)
+			{
+				auto index = (is_worker() ? current_index :
+					m_next.fetch_add(1U, std::memory_order_relaxed) % std::size(m_workers));
+
+				{
+					std::scoped_lock lock(m_mutex);
+
+					++m_pending; // note: before publishing, thieves decrement on pop
+				}
+
+				{
+					std::scoped_lock lock(m_workers[index]->mutex);
+
+					m_workers[index]->tasks.push_back(std::move(task));
+				}
+
+				m_condition.notify_one();
+			}
+
+			bool Executor::run_pending()
+			{
+				task_t task;
+
+				if (pop((is_worker() ? current_index : 0U), task))
+				{
+					execute(task);
+
+					return true;
+				}
+
+				return false;
+			}
+
+			void Executor::wait(const Latch & latch)
+			{
+				if (is_worker())
+				{
+					while (!latch.try_wait())
+					{
+						if (!run_pending())
+						{
+							std::this_thread::yield();
+						}
+					}
+				}
+				else
+				{
+					latch.wait();
+				}
+			}
+
+			bool Executor::pop(std::size_t index, task_t & task)
+			{
+				auto & worker = *m_workers[index];
+
+				auto is_found = false;
+
+				{
+					std::scoped_lock lock(worker.mutex);
+
+					if (!worker.tasks.empty())
+					{
+						task = std::move(worker.tasks.back());
+
+						worker.tasks.pop_back();
+
+						is_found = true;
+					}
+				}
+
+				for (auto iterator = std::begin(worker.victims);
+					!is_found && iterator != std::end(worker.victims); ++iterator)
+				{
+					auto & victim = *m_workers[*iterator];
+
+					std::scoped_lock lock(victim.mutex);
+
+					if (!victim.tasks.empty())
+					{
+						task = std::move(victim.tasks.front());
+
+						victim.tasks.pop_front();
+
+						is_found = true;
+					}
+				}
+
+				if (is_found)
+				{
+					std::scoped_lock lock(m_mutex);
+
+					--m_pending;
+				}
+
+				return is_found;
+			}
+
+			void Executor::execute(task_t & task) const
+			{
+				try
+				{
+					task();
+				}
+				catch (const std::exception & exception)
+				{
+					RUN_LOGGER(logger);
+
+					logger.write(shared::Logger::Severity::error, exception.what());
+				}
+				catch (...)
+				{
+					RUN_LOGGER(logger);
+
+					logger.write(shared::Logger::Severity::error, "unknown exception");
+				}
+
+				task = nullptr;
+			}
+
+			std::size_t Executor::get_node(std::size_t processor)
+			{
+#if defined(_WIN32)
+				UCHAR node = 0U;
+
+				if (processor <= std::numeric_limits < UCHAR > ::max() &&
+					GetNumaProcessorNode(static_cast < UCHAR > (processor), &node) && node != 0xFFU)
+				{
+					return node;
+				}
+#elif defined(__linux__)
+				const std::filesystem::path path =
+					"/sys/devices/system/cpu/cpu" + std::to_string(processor);
+
+				std::error_code error_code;
+
+				for (const auto & entry : std::filesystem::directory_iterator(path, error_code))
+				{
+					auto name = entry.path().filename().string();
+
+					if (name.rfind("node", 0U) == 0U && std::size(name) > 4U &&
+						std::all_of(std::next(std::begin(name), 4U), std::end(name),
+							[](auto c) { return std::isdigit(static_cast < unsigned char > (c)); }))
+					{
+						return std::stoul(name.substr(4U));
+					}
+				}
+#endif // #if defined(_WIN32)
+
+				return 0U;
+			}
+
+			void Executor::set_affinity(std::thread & thread, std::size_t processor)
+			{
+#if defined(_WIN32)
+				if (processor < std::numeric_limits < DWORD_PTR > ::digits)
+				{
+					SetThreadAffinityMask(thread.native_handle(), DWORD_PTR(1U) << processor);
+				}
+#elif defined(__linux__)
+				cpu_set_t set;
+
+				CPU_ZERO(&set);
+
+				CPU_SET(processor, &set);
+
+				pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#endif // #if defined(_WIN32)
+			}
+
+			void Task_Group::wait()
+			{
+				if (m_executor.is_worker())
+				{
+					while (!is_completed())
+					{
+						if (!m_executor.run_pending())
+						{
+							std::this_thread::yield();
+						}
+					}
+				}
+				else
+				{
+					std::unique_lock lock(m_mutex);
+
+					m_condition.wait(lock, [this]() { return (m_counter == 0U); });
+				}
+			}
+
+			void Task_Group::get()
+			{
+				wait();
+
+				std::exception_ptr exception_ptr;
+
+				{
+					std::scoped_lock lock(m_mutex);
+
+					std::swap(exception_ptr, m_exception_ptr);
+				}
+
+				if (exception_ptr)
+				{
+					std::rethrow_exception(exception_ptr);
+				}
+			}
+
+			void Task_Group::complete()
+			{
+				std::scoped_lock lock(m_mutex);
+
+				if (--m_counter == 0U)
+				{
+					m_condition.notify_all();
+				}
+			}
+
+			bool Task_Group::is_completed() const
+			{
+				std::scoped_lock lock(m_mutex);
+
+				return (m_counter == 0U);
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,299 @@
+#ifndef SOLUTION_SYSTEM_MARKET_EXECUTOR_HPP
+#define SOLUTION_SYSTEM_MARKET_EXECUTOR_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <filesystem>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include "../latch/latch.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class executor_exception : public std::exception
+			{
+			public:
+
+				explicit executor_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit executor_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~executor_exception() noexcept = default;
+			};
+
+			class Executor : private boost::noncopyable
+			{
+			public:
+
+				using task_t = std::function < void() > ;
+
+				using size_policy_t = std::function < std::size_t(std::size_t) > ;
+
+			public:
+
+				struct Size_Policy
+				{
+					static std::size_t hardware_concurrency(std::size_t n_processors) noexcept
+					{
+						return n_processors;
+					}
+
+					static std::size_t reserve_one(std::size_t n_processors) noexcept
+					{
+						return std::max(n_processors, std::size_t(2U)) - 1U;
+					}
+
+					static size_policy_t fixed(std::size_t size)
+					{
+						return [size](std::size_t) { return size; };
+					}
+				};
+
+			public:
+
+				struct Parameters
+				{
+					size_policy_t size_policy = Size_Policy::hardware_concurrency;
+
+					bool required_affinity = false;
+
+					bool required_numa = false;
+				};
+
+			private:
+
+				struct Worker
+				{
+					std::deque < task_t > tasks;
+
+					std::mutex mutex;
+
+					std::size_t processor = 0U;
+					std::size_t node      = 0U;
+
+					std::vector < std::size_t > victims; // same node first
+				};
+
+			private:
+
+				using workers_container_t = std::vector < std::unique_ptr < Worker > > ;
+
+				using threads_container_t = std::vector < std::thread > ;
+
+			private:
+
+				explicit Executor(const Parameters & parameters) : m_parameters(parameters)
+				{
+					initialize();
+				}
+
+			public:
+
+				~Executor() noexcept
+				{
+					try
+					{
+						uninitialize();
+					}
+					catch (...)
+					{
+						// std::abort();
+					}
+				}
+
+			public:
+
+				static Executor & instance();
+
+				static Executor & instance(const Parameters & parameters);
+
+			private:
+
+				static Executor & storage(const Parameters * parameters);
+
+			private:
+
+				void initialize();
+
+				void uninitialize();
+
+			private:
+
+				void place_workers();
+
+				void run(std::size_t index);
+
+			public:
+
+				void post(task_t task);
+
+				bool run_pending();
+
+				void wait(const Latch & latch);
+
+			public:
+
+				bool is_worker() const noexcept
+				{
+					return (current_executor == this);
+				}
+
+				std::size_t size() const noexcept
+				{
+					return std::size(m_workers);
+				}
+
+			private:
+
+				bool pop(std::size_t index, task_t & task);
+
+				void execute(task_t & task) const;
+
+			private:
+
+				static std::size_t get_n_processors() noexcept;
+
+				static std::size_t get_node(std::size_t processor);
+
+				static void set_affinity(std::thread & thread, std::size_t processor);
+
+			private:
+
+				static inline const std::size_t npos = std::numeric_limits < std::size_t > ::max();
+
+			private:
+
+				static inline thread_local const Executor * current_executor = nullptr;
+
+				static inline thread_local std::size_t current_index = npos;
+
+			private:
+
+				const Parameters m_parameters;
+
+				workers_container_t m_workers;
+
+				threads_container_t m_threads;
+
+				std::atomic < std::size_t > m_next = 0U;
+
+				std::size_t m_pending = 0U;
+
+				bool m_is_stopped = false;
+
+				std::mutex m_mutex;
+
+				std::condition_variable m_condition;
+			};
+
+			class Task_Group : private boost::noncopyable
+			{
+			public:
+
+				explicit Task_Group(Executor & executor) noexcept : m_executor(executor)
+				{}
+
+				~Task_Group() noexcept
+				{
+					try
+					{
+						wait();
+					}
+					catch (...)
+					{
+						// std::abort();
+					}
+				}
+
+			public:
+
+				template < typename Function >
+				void run(Function && function)
+				{
+					{
+						std::scoped_lock lock(m_mutex);
+
+						++m_counter;
+					}
+
+					m_executor.post([this, function = std::forward < Function > (function)]() mutable
+						{
+							try
+							{
+								function();
+							}
+							catch (...)
+							{
+								std::scoped_lock lock(m_mutex);
+
+								if (!m_exception_ptr)
+								{
+									m_exception_ptr = std::current_exception();
+								}
+							}
+
+							complete();
+						});
+				}
+
+				void wait();
+
+				void get();
+
+			private:
+
+				void complete();
+
+				bool is_completed() const;
+
+			private:
+
+				Executor & m_executor;
+
+				std::size_t m_counter = 0U;
+
+				std::exception_ptr m_exception_ptr;
+
+				mutable std::mutex m_mutex;
+
+				std::condition_variable m_condition;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_EXECUTOR_HPP
\ No newline at end of file
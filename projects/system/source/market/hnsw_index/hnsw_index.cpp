@@ -0,0 +1,569 @@
+#include "hnsw_index.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void HNSW_Index::Visited::reset(std::size_t size)
+			{
+				if (++epoch == 0U)
+				{
+					std::fill(std::begin(tags), std::end(tags), 0U);
+
+					epoch = 1U;
+				}
+
+				tags.resize(size, 0U);
+			}
+
+			void HNSW_Index::initialize()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (m_n_features == 0U)
+					{
+						throw std::domain_error("required n_features > 0");
+					}
+
+					if (m_parameters.max_connections < 2U || m_parameters.ef_construction == 0U)
+					{
+						throw std::domain_error("required max_connections > 1 and ef_construction > 0");
+					}
+
+					m_level_multiplier = 1.0 / std::log(static_cast < double > (m_parameters.max_connections));
+
+					m_engine.seed(m_parameters.seed);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < hnsw_index_exception > (logger, exception);
+				}
+			}
+
+			HNSW_Index::node_t HNSW_Index::insert(const feature_t * features, timestamp_t timestamp)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto node = static_cast < node_t > (size());
+
+					m_features.insert(std::end(m_features), features, features + m_n_features);
+
+					m_timestamps.push_back(timestamp);
+
+					const auto level = make_level();
+
+					m_links.emplace_back(level + 1U);
+
+					if (node == 0U)
+					{
+						m_entry = node; m_max_level = level;
+
+						return node;
+					}
+
+					const auto query = make_query(features, timestamp, 0LL);
+
+					Candidate entry { distance(query, m_entry), m_entry };
+
+					for (auto l = m_max_level; l > level; --l)
+					{
+						entry = search_greedy(query, entry, l);
+					}
+
+					for (auto l = std::min(level, m_max_level) + 1U; l-- > 0U; )
+					{
+						m_visited.reset(size());
+
+						auto links = select_neighbours(search_layer(query, entry,
+							m_parameters.ef_construction, l, m_visited), m_parameters.max_connections);
+
+						entry = Candidate { distance(query, links.front()), links.front() };
+
+						for (auto neighbour : links)
+						{
+							connect(neighbour, node, l);
+						}
+
+						m_links[node][l] = std::move(links);
+					}
+
+					if (level > m_max_level)
+					{
+						m_entry = node; m_max_level = level;
+					}
+
+					return node;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < hnsw_index_exception > (logger, exception);
+				}
+			}
+
+			void HNSW_Index::insert(const Environment::View & view)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (view.n_features() != m_n_features)
+					{
+						throw std::invalid_argument("different sizes of features");
+					}
+
+					m_features.reserve(std::size(m_features) + std::size(view) * m_n_features);
+
+					m_timestamps.reserve(size() + std::size(view));
+
+					m_links.reserve(size() + std::size(view));
+
+					for (auto i = 0U; i < std::size(view); ++i)
+					{
+						insert(view.features(i), view.timestamp(i));
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < hnsw_index_exception > (logger, exception);
+				}
+			}
+
+			HNSW_Index::results_container_t HNSW_Index::find(const Environment::View & queries,
+				std::size_t k, std::size_t ef, std::time_t exclusion) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (queries.n_features() != m_n_features)
+					{
+						throw std::invalid_argument("different sizes of features");
+					}
+
+					results_container_t results(std::size(queries));
+
+					const auto n_chunks = std::max(std::min(m_executor.size(), std::size(queries)), std::size_t(1U));
+
+					const auto chunk_size = (std::size(queries) + n_chunks - 1U) / n_chunks;
+
+					Task_Group group(m_executor);
+
+					for (auto chunk = 0U; chunk < n_chunks; ++chunk)
+					{
+						group.run([this, &queries, &results, chunk, chunk_size, k, ef, exclusion]()
+							{
+								Visited visited;
+
+								const auto first = std::min(chunk * chunk_size, std::size(queries));
+								const auto last  = std::min(first + chunk_size, std::size(queries));
+
+								for (auto i = first; i < last; ++i)
+								{
+									results[i] = find(make_query(queries.features(i), queries.timestamp(i), exclusion), k, ef, visited);
+								}
+							});
+					}
+
+					group.get();
+
+					return results;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < hnsw_index_exception > (logger, exception);
+				}
+			}
+
+			HNSW_Index::neighbours_container_t HNSW_Index::find(const feature_t * features,
+				timestamp_t timestamp, std::size_t k, std::size_t ef, std::time_t exclusion) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					Visited visited;
+
+					return find(make_query(features, timestamp, exclusion), k, ef, visited);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < hnsw_index_exception > (logger, exception);
+				}
+			}
+
+			void HNSW_Index::save(const path_t & path) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					std::fstream fout(path.string(), std::ios::out | std::ios::binary);
+
+					if (!fout)
+					{
+						throw hnsw_index_exception("cannot open file " + path.string());
+					}
+
+					auto write = [&fout](auto value)
+					{
+						fout.write(reinterpret_cast < const char * > (&value), sizeof(value));
+					};
+
+					fout.write(Header::magic.data(), std::size(Header::magic));
+
+					write(Header::version);
+					write(static_cast < std::uint32_t > (sizeof(feature_t)));
+
+					write(static_cast < std::uint64_t > (m_n_features));
+					write(static_cast < std::uint64_t > (m_parameters.max_connections));
+					write(static_cast < std::uint64_t > (m_parameters.ef_construction));
+					write(static_cast < std::uint64_t > (m_parameters.seed));
+					write(static_cast < std::uint64_t > (size()));
+					write(static_cast < std::uint64_t > (m_max_level));
+					write(static_cast < std::uint32_t > (m_entry));
+
+					fout.write(reinterpret_cast < const char * > (m_features.data()),
+						std::size(m_features) * sizeof(feature_t));
+
+					fout.write(reinterpret_cast < const char * > (m_timestamps.data()),
+						std::size(m_timestamps) * sizeof(timestamp_t));
+
+					for (const auto & levels : m_links)
+					{
+						write(static_cast < std::uint32_t > (std::size(levels)));
+
+						for (const auto & links : levels)
+						{
+							write(static_cast < std::uint32_t > (std::size(links)));
+
+							fout.write(reinterpret_cast < const char * > (links.data()), std::size(links) * sizeof(node_t));
+						}
+					}
+
+					if (!fout)
+					{
+						throw hnsw_index_exception("cannot write file " + path.string());
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < hnsw_index_exception > (logger, exception);
+				}
+			}
+
+			void HNSW_Index::load(const path_t & path)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					std::fstream fin(path.string(), std::ios::in | std::ios::binary);
+
+					if (!fin)
+					{
+						throw hnsw_index_exception("cannot open file " + path.string());
+					}
+
+					auto read = [&fin](auto & value)
+					{
+						fin.read(reinterpret_cast < char * > (&value), sizeof(value));
+					};
+
+					std::string magic(std::size(Header::magic), '\0');
+
+					fin.read(magic.data(), std::size(magic));
+
+					std::uint32_t version      = 0U;
+					std::uint32_t feature_size = 0U;
+
+					read(version);
+					read(feature_size);
+
+					if (magic != Header::magic || version != Header::version || feature_size != sizeof(feature_t))
+					{
+						throw hnsw_index_exception("invalid header in " + path.string());
+					}
+
+					std::uint64_t n_features      = 0U;
+					std::uint64_t max_connections = 0U;
+					std::uint64_t ef_construction = 0U;
+					std::uint64_t seed            = 0U;
+					std::uint64_t size            = 0U;
+					std::uint64_t max_level       = 0U;
+					std::uint32_t entry           = 0U;
+
+					read(n_features);
+					read(max_connections);
+					read(ef_construction);
+					read(seed);
+					read(size);
+					read(max_level);
+					read(entry);
+
+					if (!fin || (size != 0U && entry >= size))
+					{
+						throw hnsw_index_exception("invalid header in " + path.string());
+					}
+
+					m_n_features = n_features;
+
+					m_parameters = Parameters { max_connections, ef_construction, seed };
+
+					initialize();
+
+					m_engine.seed(seed + size); // note: levels of further insertions differ from one long run
+
+					m_features.resize(size * n_features);
+					m_timestamps.resize(size);
+
+					fin.read(reinterpret_cast < char * > (m_features.data()), std::size(m_features) * sizeof(feature_t));
+
+					fin.read(reinterpret_cast < char * > (m_timestamps.data()), std::size(m_timestamps) * sizeof(timestamp_t));
+
+					m_links.assign(size, {});
+
+					for (auto & levels : m_links)
+					{
+						std::uint32_t n_levels = 0U;
+
+						read(n_levels);
+
+						if (!fin || n_levels == 0U || n_levels > max_level + 1U)
+						{
+							throw hnsw_index_exception("invalid links in " + path.string());
+						}
+
+						levels.resize(n_levels);
+
+						for (auto & links : levels)
+						{
+							std::uint32_t n_links = 0U;
+
+							read(n_links);
+
+							links.resize(n_links);
+
+							fin.read(reinterpret_cast < char * > (links.data()), std::size(links) * sizeof(node_t));
+
+							if (!fin || std::any_of(std::begin(links), std::end(links), [size](auto node) { return node >= size; }))
+							{
+								throw hnsw_index_exception("invalid links in " + path.string());
+							}
+						}
+					}
+
+					m_entry = entry;
+
+					m_max_level = max_level;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < hnsw_index_exception > (logger, exception);
+				}
+			}
+
+			std::size_t HNSW_Index::make_level()
+			{
+				std::uniform_real_distribution < double > distribution(0.0, 1.0);
+
+				return static_cast < std::size_t > (-std::log(1.0 - distribution(m_engine)) * m_level_multiplier);
+			}
+
+			HNSW_Index::Query HNSW_Index::make_query(const feature_t * features, timestamp_t timestamp, std::time_t exclusion) const
+			{
+				Query query;
+
+				query.features = features;
+
+				KNN_Engine::make_scales(features, m_n_features, query.scales);
+
+				query.timestamp = timestamp;
+
+				query.exclusion = exclusion;
+
+				return query;
+			}
+
+			HNSW_Index::Candidate HNSW_Index::search_greedy(const Query & query, Candidate entry, std::size_t level) const
+			{
+				for (auto is_changed = true; is_changed; )
+				{
+					is_changed = false;
+
+					for (auto neighbour : m_links[entry.node][level])
+					{
+						if (const auto current_distance = distance(query, neighbour); current_distance < entry.distance)
+						{
+							entry = Candidate { current_distance, neighbour }; is_changed = true;
+						}
+					}
+				}
+
+				return entry;
+			}
+
+			HNSW_Index::max_queue_t HNSW_Index::search_layer(const Query & query, Candidate entry,
+				std::size_t ef, std::size_t level, Visited & visited) const
+			{
+				min_queue_t candidates;
+				max_queue_t results;
+
+				visited.insert(entry.node);
+
+				candidates.push(entry);
+
+				if (!is_excluded(query, entry.node))
+				{
+					results.push(entry);
+				}
+
+				auto bound = (std::empty(results) ? std::numeric_limits < float > ::infinity() : results.top().distance);
+
+				while (!std::empty(candidates))
+				{
+					const auto candidate = candidates.top();
+
+					if (candidate.distance > bound && (std::size(results) == ef || query.exclusion == 0LL))
+					{
+						break; // note: with exclusion the layer is explored until ef results are admitted
+					}
+
+					candidates.pop();
+
+					for (auto neighbour : m_links[candidate.node][level])
+					{
+						if (!visited.insert(neighbour))
+						{
+							continue;
+						}
+
+						if (const auto current_distance = distance(query, neighbour);
+							std::size(results) < ef || current_distance < bound)
+						{
+							candidates.push(Candidate { current_distance, neighbour });
+
+							if (!is_excluded(query, neighbour))
+							{
+								results.push(Candidate { current_distance, neighbour });
+
+								if (std::size(results) > ef)
+								{
+									results.pop();
+								}
+
+								bound = results.top().distance;
+							}
+						}
+					}
+				}
+
+				return results;
+			}
+
+			HNSW_Index::neighbours_container_t HNSW_Index::find(const Query & query,
+				std::size_t k, std::size_t ef, Visited & visited) const
+			{
+				if (size() == 0U || k == 0U)
+				{
+					return {};
+				}
+
+				Candidate entry { distance(query, m_entry), m_entry };
+
+				for (auto l = m_max_level; l > 0U; --l)
+				{
+					entry = search_greedy(query, entry, l);
+				}
+
+				visited.reset(size());
+
+				auto results = search_layer(query, entry, std::max(ef, k), 0U, visited);
+
+				while (std::size(results) > k)
+				{
+					results.pop();
+				}
+
+				neighbours_container_t neighbours(std::size(results));
+
+				for (auto i = std::size(neighbours); i-- > 0U; results.pop())
+				{
+					neighbours[i] = Neighbour { results.top().distance, results.top().node };
+				}
+
+				return neighbours;
+			}
+
+			HNSW_Index::links_container_t HNSW_Index::select_neighbours(max_queue_t candidates, std::size_t size) const
+			{
+				std::vector < Candidate > sorted_candidates(std::size(candidates));
+
+				for (auto i = std::size(sorted_candidates); i-- > 0U; candidates.pop())
+				{
+					sorted_candidates[i] = candidates.top();
+				}
+
+				links_container_t links;
+
+				links.reserve(size);
+
+				std::vector < feature_t > scales;
+
+				for (const auto & candidate : sorted_candidates) // note: heuristic, keeps diverse directions
+				{
+					if (std::size(links) == size)
+					{
+						break;
+					}
+
+					KNN_Engine::make_scales(features(candidate.node), m_n_features, scales);
+
+					if (std::none_of(std::begin(links), std::end(links), [this, &candidate, &scales](auto link)
+						{
+							return (KNN_Engine::distance(features(candidate.node), scales.data(),
+								features(link), m_n_features) < candidate.distance);
+						}))
+					{
+						links.push_back(candidate.node);
+					}
+				}
+
+				return links;
+			}
+
+			void HNSW_Index::connect(node_t node, node_t neighbour, std::size_t level)
+			{
+				auto & links = m_links[node][level];
+
+				if (std::size(links) < max_links(level))
+				{
+					links.push_back(neighbour);
+
+					return;
+				}
+
+				const auto query = make_query(features(node), m_timestamps[node], 0LL);
+
+				max_queue_t candidates;
+
+				candidates.push(Candidate { distance(query, neighbour), neighbour });
+
+				for (auto link : links)
+				{
+					candidates.push(Candidate { distance(query, link), link });
+				}
+
+				links = select_neighbours(std::move(candidates), max_links(level));
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
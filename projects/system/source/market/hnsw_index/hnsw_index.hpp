@@ -0,0 +1,260 @@
+#ifndef SOLUTION_SYSTEM_MARKET_HNSW_INDEX_HPP
+#define SOLUTION_SYSTEM_MARKET_HNSW_INDEX_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../environment/environment.hpp"
+#include "../executor/executor.hpp"
+#include "../knn_engine/knn_engine.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class hnsw_index_exception : public std::exception
+			{
+			public:
+
+				explicit hnsw_index_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit hnsw_index_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~hnsw_index_exception() noexcept = default;
+			};
+
+			class HNSW_Index // note: approximate top-k, same distance and exclusion as KNN_Engine
+			{
+			public:
+
+				using feature_t = Environment::feature_t;
+
+				using timestamp_t = Environment::timestamp_t;
+
+				using node_t = std::uint32_t;
+
+				using Neighbour = KNN_Engine::Neighbour;
+
+				using neighbours_container_t = KNN_Engine::neighbours_container_t;
+
+				using results_container_t = KNN_Engine::results_container_t;
+
+				struct Parameters
+				{
+					std::size_t max_connections = 16U; // note: 2x on level 0
+
+					std::size_t ef_construction = 200U;
+
+					std::uint64_t seed = 0ULL;
+				};
+
+			private:
+
+				using links_container_t = std::vector < node_t > ;
+
+				using path_t = std::filesystem::path;
+
+				struct Candidate
+				{
+					float distance = 0.0F;
+
+					node_t node = 0U;
+				};
+
+				struct Greater
+				{
+					bool operator()(const Candidate & lhs, const Candidate & rhs) const noexcept
+					{
+						return (lhs.distance > rhs.distance || (lhs.distance == rhs.distance && lhs.node > rhs.node));
+					}
+				};
+
+				struct Less
+				{
+					bool operator()(const Candidate & lhs, const Candidate & rhs) const noexcept
+					{
+						return (lhs.distance < rhs.distance || (lhs.distance == rhs.distance && lhs.node < rhs.node));
+					}
+				};
+
+				using min_queue_t = std::priority_queue < Candidate, std::vector < Candidate > , Greater > ;
+				using max_queue_t = std::priority_queue < Candidate, std::vector < Candidate > , Less    > ;
+
+				struct Visited // note: epoch tags, reused between queries of one task
+				{
+					std::vector < std::uint32_t > tags;
+
+					std::uint32_t epoch = 0U;
+
+					void reset(std::size_t size);
+
+					bool insert(node_t node)
+					{
+						return ((tags[node] == epoch) ? false : (tags[node] = epoch, true));
+					}
+				};
+
+				struct Query
+				{
+					const feature_t * features = nullptr;
+
+					std::vector < feature_t > scales;
+
+					timestamp_t timestamp = 0LL;
+
+					std::time_t exclusion = 0LL;
+				};
+
+				struct Header
+				{
+					static inline const std::string magic = "HNSWINDX"; // 8 bytes
+
+					static inline const std::uint32_t version = 1U;
+				};
+
+			public:
+
+				explicit HNSW_Index(Executor & executor, std::size_t n_features, const Parameters & parameters) :
+					m_executor(executor), m_n_features(n_features), m_parameters(parameters)
+				{
+					initialize();
+				}
+
+				~HNSW_Index() noexcept = default;
+
+			private:
+
+				void initialize();
+
+			public:
+
+				std::size_t size() const noexcept
+				{
+					return std::size(m_timestamps);
+				}
+
+				std::size_t n_features() const noexcept
+				{
+					return m_n_features;
+				}
+
+				const feature_t * features(node_t node) const noexcept
+				{
+					return m_features.data() + node * m_n_features;
+				}
+
+				timestamp_t timestamp(node_t node) const noexcept
+				{
+					return m_timestamps[node];
+				}
+
+			public:
+
+				node_t insert(const feature_t * features, timestamp_t timestamp); // note: not concurrent with find
+
+				void insert(const Environment::View & view);
+
+				results_container_t find(const Environment::View & queries, std::size_t k, std::size_t ef,
+					std::time_t exclusion = 0LL) const;
+
+				neighbours_container_t find(const feature_t * features, timestamp_t timestamp, std::size_t k, std::size_t ef,
+					std::time_t exclusion = 0LL) const;
+
+			public:
+
+				void save(const path_t & path) const;
+
+				void load(const path_t & path);
+
+			private:
+
+				std::size_t make_level();
+
+				std::size_t max_links(std::size_t level) const noexcept
+				{
+					return ((level == 0U) ? 2U : 1U) * m_parameters.max_connections;
+				}
+
+				float distance(const Query & query, node_t node) const noexcept
+				{
+					return KNN_Engine::distance(query.features, query.scales.data(), features(node), m_n_features);
+				}
+
+				Query make_query(const feature_t * features, timestamp_t timestamp, std::time_t exclusion) const;
+
+				bool is_excluded(const Query & query, node_t node) const noexcept
+				{
+					return (std::abs(m_timestamps[node] - query.timestamp) < query.exclusion);
+				}
+
+				Candidate search_greedy(const Query & query, Candidate entry, std::size_t level) const;
+
+				max_queue_t search_layer(const Query & query, Candidate entry, std::size_t ef, std::size_t level,
+					Visited & visited) const;
+
+				neighbours_container_t find(const Query & query, std::size_t k, std::size_t ef, Visited & visited) const;
+
+				links_container_t select_neighbours(max_queue_t candidates, std::size_t size) const;
+
+				void connect(node_t node, node_t neighbour, std::size_t level);
+
+			private:
+
+				Executor & m_executor;
+
+				std::size_t m_n_features;
+
+				Parameters m_parameters;
+
+				double m_level_multiplier = 0.0;
+
+				std::mt19937_64 m_engine;
+
+				std::vector < feature_t > m_features; // note: row-major, size x n_features
+
+				std::vector < timestamp_t > m_timestamps;
+
+				std::vector < std::vector < links_container_t > > m_links; // note: node, level
+
+				node_t m_entry = 0U;
+
+				std::size_t m_max_level = 0U;
+
+				Visited m_visited; // note: insertions only
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_HNSW_INDEX_HPP
\ No newline at end of file
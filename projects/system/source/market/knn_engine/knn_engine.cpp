@@ -0,0 +1,281 @@
+#include "knn_engine.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void KNN_Engine::initialize()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (m_parameters.k == 0U || m_parameters.batch_size == 0U)
+					{
+						throw std::domain_error("required k > 0 and batch size > 0");
+					}
+
+					if (!std::is_sorted(m_train.timestamps(), m_train.timestamps() + std::size(m_train)))
+					{
+						throw std::logic_error("train rows are not sorted by time");
+					}
+
+					if (m_parameters.is_quantized)
+					{
+						m_quantizer = Quantizer(m_train);
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < knn_engine_exception > (logger, exception);
+				}
+			}
+
+			KNN_Engine::results_container_t KNN_Engine::find(const Environment::View & queries) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (queries.n_features() != m_train.n_features())
+					{
+						throw std::invalid_argument("different sizes of features");
+					}
+
+					results_container_t results(std::size(queries));
+
+					std::vector < Query > batch;
+
+					batch.reserve(m_parameters.batch_size);
+
+					for (auto first = 0U; first < std::size(queries); first += m_parameters.batch_size)
+					{
+						const auto last = std::min(first + m_parameters.batch_size, std::size(queries));
+
+						batch.clear();
+
+						for (auto index = first; index < last; ++index)
+						{
+							batch.push_back(make_query(queries, index));
+						}
+
+						results_container_t batch_results;
+
+						find(batch, batch_results);
+
+						std::move(std::begin(batch_results), std::end(batch_results), std::next(std::begin(results), first));
+					}
+
+					return results;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < knn_engine_exception > (logger, exception);
+				}
+			}
+
+			float KNN_Engine::distance(const feature_t * query, const feature_t * scales,
+				const feature_t * features, std::size_t size) noexcept
+			{
+				auto j = 0U;
+
+				auto distance = 0.0F;
+
+#if defined(__AVX__)
+				const auto mask_8 = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+				const auto ones_8 = _mm256_set1_ps(1.0F);
+
+				auto sum_8 = _mm256_setzero_ps();
+
+				for (; j + 8U <= size; j += 8U)
+				{
+					const auto difference = _mm256_and_ps(_mm256_sub_ps(
+						_mm256_loadu_ps(query + j), _mm256_loadu_ps(features + j)), mask_8);
+
+					sum_8 = _mm256_add_ps(sum_8, _mm256_min_ps(_mm256_mul_ps(difference, _mm256_loadu_ps(scales + j)), ones_8));
+				}
+
+				auto sum_4 = _mm_add_ps(_mm256_castps256_ps128(sum_8), _mm256_extractf128_ps(sum_8, 1));
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+				auto sum_4 = _mm_setzero_ps();
+#endif
+
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+				const auto mask_4 = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+				const auto ones_4 = _mm_set1_ps(1.0F);
+
+				for (; j + 4U <= size; j += 4U)
+				{
+					const auto difference = _mm_and_ps(_mm_sub_ps(
+						_mm_loadu_ps(query + j), _mm_loadu_ps(features + j)), mask_4);
+
+					sum_4 = _mm_add_ps(sum_4, _mm_min_ps(_mm_mul_ps(difference, _mm_loadu_ps(scales + j)), ones_4));
+				}
+
+				alignas(16) float sums[4];
+
+				_mm_store_ps(sums, sum_4);
+
+				distance = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+#endif
+
+				for (; j < size; ++j)
+				{
+					distance += std::min(std::abs(query[j] - features[j]) * scales[j], 1.0F);
+				}
+
+				return distance;
+			}
+
+			void KNN_Engine::make_scales(const feature_t * query, std::size_t size, std::vector < feature_t > & scales)
+			{
+				const auto epsilon = std::numeric_limits < double > ::epsilon(); // note: as Market::distance
+
+				scales.resize(size);
+
+				for (auto j = 0U; j < size; ++j)
+				{
+					scales[j] = static_cast < feature_t > (1.0 / std::max(std::abs(static_cast < double > (query[j])), epsilon));
+				}
+			}
+
+			KNN_Engine::Query KNN_Engine::make_query(const Environment::View & queries, std::size_t index) const
+			{
+				Query query;
+
+				query.features = queries.features(index);
+
+				make_scales(query.features, queries.n_features(), query.scales);
+
+				if (m_parameters.is_quantized)
+				{
+					m_quantizer.make_query(query.features, query.offsets, query.weights);
+				}
+
+				const auto timestamp = queries.timestamp(index);
+
+				const auto first = m_train.timestamps();
+				const auto last  = m_train.timestamps() + std::size(m_train);
+
+				if (m_parameters.exclusion > 0LL) // note: |t - t_query| < exclusion
+				{
+					query.first = std::distance(first, std::upper_bound(first, last, timestamp - m_parameters.exclusion));
+					query.last  = std::distance(first, std::lower_bound(first, last, timestamp + m_parameters.exclusion));
+				}
+
+				return query;
+			}
+
+			void KNN_Engine::find(const std::vector < Query > & queries, results_container_t & results) const
+			{
+				const auto size = std::size(m_train);
+
+				const auto n_features = m_train.n_features();
+
+				const auto n_candidates = (m_parameters.is_quantized ? std::max(m_parameters.k, m_parameters.rerank) : m_parameters.k);
+
+				const auto n_chunks = std::max(std::min(m_executor.size(), size / min_chunk_size), std::size_t(1U));
+
+				const auto chunk_size = (size + n_chunks - 1U) / n_chunks;
+
+				std::vector < results_container_t > heaps(n_chunks, results_container_t(std::size(queries)));
+
+				Task_Group group(m_executor);
+
+				for (auto chunk = 0U; chunk < n_chunks; ++chunk)
+				{
+					group.run([this, &queries, &heaps, chunk, chunk_size, size, n_features, n_candidates]()
+						{
+							auto & chunk_heaps = heaps[chunk]; // note: bounded max-heaps, one per query
+
+							const auto first = std::min(chunk * chunk_size, size);
+							const auto last  = std::min(first + chunk_size, size);
+
+							for (auto row = first; row < last; ++row) // note: each row is loaded once per batch
+							{
+								const auto features = m_train.features(row);
+
+								const auto codes = (m_parameters.is_quantized ? m_quantizer.codes(row) : nullptr);
+
+								for (auto i = 0U; i < std::size(queries); ++i)
+								{
+									const auto & query = queries[i];
+
+									if (row >= query.first && row < query.last)
+									{
+										continue;
+									}
+
+									Neighbour neighbour { (m_parameters.is_quantized ?
+										Quantizer::distance(query.offsets.data(), query.weights.data(), codes, n_features) :
+										distance(query.features, query.scales.data(), features, n_features)), row };
+
+									auto & heap = chunk_heaps[i];
+
+									if (std::size(heap) < n_candidates)
+									{
+										heap.push_back(neighbour);
+
+										std::push_heap(std::begin(heap), std::end(heap), less);
+									}
+									else if (less(neighbour, heap.front()))
+									{
+										std::pop_heap(std::begin(heap), std::end(heap), less);
+
+										heap.back() = neighbour;
+
+										std::push_heap(std::begin(heap), std::end(heap), less);
+									}
+								}
+							}
+						});
+				}
+
+				group.get();
+
+				results.assign(std::size(queries), neighbours_container_t());
+
+				for (auto i = 0U; i < std::size(queries); ++i)
+				{
+					auto & result = results[i];
+
+					for (const auto & chunk_heaps : heaps)
+					{
+						result.insert(std::end(result), std::begin(chunk_heaps[i]), std::end(chunk_heaps[i]));
+					}
+
+					if (m_parameters.is_quantized && m_parameters.rerank > 0U)
+					{
+						const auto n = std::min(n_candidates, std::size(result));
+
+						std::partial_sort(std::begin(result), std::next(std::begin(result), n), std::end(result), less);
+
+						result.resize(n);
+
+						rerank(queries[i], result);
+					}
+
+					const auto k = std::min(m_parameters.k, std::size(result));
+
+					std::partial_sort(std::begin(result), std::next(std::begin(result), k), std::end(result), less);
+
+					result.resize(k);
+				}
+			}
+
+			void KNN_Engine::rerank(const Query & query, neighbours_container_t & neighbours) const
+			{
+				for (auto & neighbour : neighbours)
+				{
+					neighbour.distance = distance(query.features, query.scales.data(),
+						m_train.features(neighbour.index), m_train.n_features());
+				}
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,158 @@
+#ifndef SOLUTION_SYSTEM_MARKET_KNN_ENGINE_HPP
+#define SOLUTION_SYSTEM_MARKET_KNN_ENGINE_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <ctime>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <immintrin.h>
+#endif
+
+#include "../environment/environment.hpp"
+#include "../executor/executor.hpp"
+#include "../quantizer/quantizer.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class knn_engine_exception : public std::exception
+			{
+			public:
+
+				explicit knn_engine_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit knn_engine_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~knn_engine_exception() noexcept = default;
+			};
+
+			class KNN_Engine // note: exact top-k, train rows sorted by time, queries in batches
+			{
+			public:
+
+				using feature_t = Environment::feature_t;
+
+				using timestamp_t = Environment::timestamp_t;
+
+				struct Parameters
+				{
+					std::size_t k = 1U;
+
+					std::time_t exclusion = 0LL; // note: neighbours closer in time are skipped, seconds
+
+					std::size_t batch_size = 32U;
+
+					bool is_quantized = false; // note: scan over int8 codes, distances are approximate
+
+					std::size_t rerank = 0U; // note: quantized candidates rescored in full precision, 0: none
+				};
+
+				struct Neighbour
+				{
+					float distance = 0.0F;
+
+					std::size_t index = 0U; // note: row of train view
+				};
+
+				using neighbours_container_t = std::vector < Neighbour > ;
+
+				using results_container_t = std::vector < neighbours_container_t > ;
+
+			private:
+
+				struct Query
+				{
+					const feature_t * features = nullptr;
+
+					std::vector < feature_t > scales; // note: 1 / max(|x|, epsilon)
+
+					std::vector < feature_t > offsets; // note: quantized mode only
+					std::vector < feature_t > weights;
+
+					std::size_t first = 0U; // note: excluded rows [first, last)
+					std::size_t last  = 0U;
+				};
+
+			public:
+
+				explicit KNN_Engine(Executor & executor, const Environment::View & train, const Parameters & parameters) :
+					m_executor(executor), m_train(train), m_parameters(parameters)
+				{
+					initialize();
+				}
+
+				~KNN_Engine() noexcept = default;
+
+			private:
+
+				void initialize();
+
+			public:
+
+				results_container_t find(const Environment::View & queries) const;
+
+			public:
+
+				static float distance(const feature_t * query, const feature_t * scales,
+					const feature_t * features, std::size_t size) noexcept;
+
+				static void make_scales(const feature_t * query, std::size_t size, std::vector < feature_t > & scales);
+
+			private:
+
+				Query make_query(const Environment::View & queries, std::size_t index) const;
+
+				void find(const std::vector < Query > & queries, results_container_t & results) const;
+
+				void rerank(const Query & query, neighbours_container_t & neighbours) const;
+
+				static bool less(const Neighbour & lhs, const Neighbour & rhs) noexcept
+				{
+					return (lhs.distance < rhs.distance || (lhs.distance == rhs.distance && lhs.index < rhs.index));
+				}
+
+			private:
+
+				static inline const std::size_t min_chunk_size = 1024U; // note: rows per task
+
+			private:
+
+				Executor & m_executor;
+
+				const Environment::View m_train;
+
+				const Parameters m_parameters;
+
+				Quantizer m_quantizer;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_KNN_ENGINE_HPP
\ No newline at end of file
@@ -0,0 +1,39 @@
+#include "latch.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void Latch::count_down(std::size_t n)
+			{
+				std::scoped_lock lock(m_mutex);
+
+				m_counter = (n < m_counter ? m_counter - n : 0U);
+
+				if (m_counter == 0U)
+				{
+					m_condition.notify_all();
+				}
+			}
+
+			bool Latch::try_wait() const
+			{
+				std::scoped_lock lock(m_mutex);
+
+				return (m_counter == 0U);
+			}
+
+			void Latch::wait() const
+			{
+				std::unique_lock lock(m_mutex);
+
+				m_condition.wait(lock, [this]() { return (m_counter == 0U); });
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
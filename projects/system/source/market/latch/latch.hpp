@@ -0,0 +1,52 @@
+#ifndef SOLUTION_SYSTEM_MARKET_LATCH_HPP
+#define SOLUTION_SYSTEM_MARKET_LATCH_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class Latch // note: std::latch is unavailable in C++17
+			{
+			public:
+
+				explicit Latch(std::size_t counter) noexcept : m_counter(counter)
+				{}
+
+				~Latch() noexcept = default;
+
+			public:
+
+				void count_down(std::size_t n = 1U);
+
+				bool try_wait() const;
+
+				void wait() const;
+
+			private:
+
+				mutable std::mutex m_mutex;
+
+				mutable std::condition_variable m_condition;
+
+				std::size_t m_counter;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_LATCH_HPP
\ No newline at end of file
@@ -0,0 +1,409 @@
+#include "level_engine.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void Level_Engine::initialize(const candles_container_t & candles)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (m_parameters.min_bias > m_parameters.max_bias)
+					{
+						throw std::domain_error("required: (min_bias <= max_bias)");
+					}
+
+					m_bars.reserve(std::size(candles));
+
+					for (const auto & candle : candles)
+					{
+						push_bar(candle);
+
+						m_bars.back().type = candle.type;
+
+						if (candle.type != Candle::Type::empty)
+						{
+							m_extrema.push_back(std::size(m_bars) - 1U);
+						}
+					}
+
+					const auto size = std::size(m_bars);
+
+					for (auto c = (size > m_parameters.max_bias + 1U ? size - m_parameters.max_bias - 1U : 0U); c < size; ++c)
+					{
+						for (auto k = c + 1U; k < size; ++k)
+						{
+							if (m_bars[c].right_min_radius == npos && m_bars[k].price < m_bars[c].price)
+							{
+								m_bars[c].right_min_radius = k - c - 1U;
+							}
+
+							if (m_bars[c].right_max_radius == npos && m_bars[k].price >= m_bars[c].price)
+							{
+								m_bars[c].right_max_radius = k - c - 1U;
+							}
+						}
+					}
+
+					m_strength_points.reserve(std::size(m_levels));
+					m_weakness_points.reserve(std::size(m_levels));
+
+					for (auto i = 0U; i < std::size(m_levels); ++i)
+					{
+						const auto & level = m_levels[i];
+
+						m_prices.emplace(level.price_low, i);
+
+						m_max_ratio = (level.price_low > 0.0 ? std::max(m_max_ratio, level.price_high / level.price_low) :
+							std::numeric_limits < double > ::infinity());
+
+						m_strength_points.push_back(std::make_shared < Points::arena_t > (
+							std::begin(level.strength_points), std::end(level.strength_points)));
+						m_weakness_points.push_back(std::make_shared < Points::arena_t > (
+							std::begin(level.weakness_points), std::end(level.weakness_points)));
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < level_engine_exception > (logger, exception);
+				}
+			}
+
+			Level Level_Engine::make_level(const Date_Time & begin, double typical_price,
+				std::size_t locality, Candle::Type type, double max_deviation)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					switch (type)
+					{
+					case Candle::Type::local_min:
+					{
+						return Level { begin,
+							typical_price * (1.0 - 2.0 * max_deviation),
+							typical_price * (1.0 + 0.5 * max_deviation),
+								locality, {}, {} };
+					}
+					case Candle::Type::local_max:
+					{
+						return Level { begin,
+							typical_price * (1.0 - 0.5 * max_deviation),
+							typical_price * (1.0 + 2.0 * max_deviation),
+								locality, {}, {} };
+					}
+					default:
+					{
+						throw level_engine_exception("unknown level type");
+					}
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < level_engine_exception > (logger, exception);
+				}
+			}
+
+			void Level_Engine::push(const Candle & candle)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (candle.date_time.to_timestamp() <= last_timestamp())
+					{
+						throw std::domain_error("required: (candle is newer than the last one)");
+					}
+
+					push_bar(candle);
+
+					resolve_right_radii();
+
+					update_levels();
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < level_engine_exception > (logger, exception);
+				}
+			}
+
+			void Level_Engine::push_bar(const Candle & candle)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					Bar bar;
+
+					bar.date_time = candle.date_time;
+					bar.timestamp = candle.date_time.to_timestamp();
+
+					bar.price_low   = candle.price_low;
+					bar.price_high  = candle.price_high;
+					bar.price_close = candle.price_close;
+
+					bar.price = (candle.price_high + candle.price_low + candle.price_close);
+
+					const auto index = std::size(m_bars);
+
+					while (!std::empty(m_min_stack) && m_bars[m_min_stack.back()].price > bar.price)
+					{
+						m_min_stack.pop_back();
+					}
+
+					while (!std::empty(m_max_stack) && m_bars[m_max_stack.back()].price <= bar.price)
+					{
+						m_max_stack.pop_back();
+					}
+
+					bar.left_min_radius = (std::empty(m_min_stack) ? index : index - m_min_stack.back() - 1U);
+					bar.left_max_radius = (std::empty(m_max_stack) ? index : index - m_max_stack.back() - 1U);
+
+					m_min_stack.push_back(index);
+					m_max_stack.push_back(index);
+
+					m_bars.push_back(bar);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < level_engine_exception > (logger, exception);
+				}
+			}
+
+			void Level_Engine::resolve_right_radii()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto last = std::size(m_bars) - 1U;
+
+					const auto & bar = m_bars[last];
+
+					for (auto c = (last > m_parameters.max_bias + 1U ? last - m_parameters.max_bias - 1U : 0U); c < last; ++c)
+					{
+						if (m_bars[c].right_min_radius == npos && bar.price < m_bars[c].price)
+						{
+							m_bars[c].right_min_radius = last - c - 1U;
+						}
+
+						if (m_bars[c].right_max_radius == npos && bar.price >= m_bars[c].price)
+						{
+							m_bars[c].right_max_radius = last - c - 1U;
+						}
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < level_engine_exception > (logger, exception);
+				}
+			}
+
+			void Level_Engine::update_levels()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto last = std::size(m_bars) - 1U;
+
+					for (auto c = (last > m_parameters.max_bias ? last - m_parameters.max_bias : 0U); c <= last; ++c)
+					{
+						const auto min_radius = radius(c, Candle::Type::local_min);
+						const auto max_radius = radius(c, Candle::Type::local_max);
+
+						const auto radius = std::max(min_radius, max_radius);
+
+						if (radius >= m_parameters.min_bias)
+						{
+							const auto locality = std::min(radius, m_parameters.max_bias);
+
+							if (auto level = m_registry.find(m_bars[c].date_time); level)
+							{
+								level->locality = locality;
+							}
+							else
+							{
+								make_extremum(c, locality, (min_radius >= m_parameters.min_bias ?
+									Candle::Type::local_min : Candle::Type::local_max));
+							}
+						}
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < level_engine_exception > (logger, exception);
+				}
+			}
+
+			void Level_Engine::make_extremum(std::size_t index, std::size_t locality, Candle::Type type)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					auto & bar = m_bars[index];
+
+					auto typical_price = (
+						bar.price_low  +
+						bar.price_high +
+						bar.price_close) / 3.0;
+
+					m_registry.insert(make_level(bar.date_time, typical_price, locality, type, m_parameters.max_deviation));
+
+					bar.type = type;
+
+					m_strength_points.push_back(std::make_shared < Points::arena_t > ());
+					m_weakness_points.push_back(std::make_shared < Points::arena_t > ());
+
+					if (!std::empty(m_extrema))
+					{
+						update_weakness(m_extrema.back(), index);
+					}
+
+					update_strength(index);
+
+					const auto & level = m_levels.back();
+
+					m_prices.emplace(level.price_low, std::size(m_levels) - 1U);
+
+					m_max_ratio = (level.price_low > 0.0 ? std::max(m_max_ratio, level.price_high / level.price_low) :
+						std::numeric_limits < double > ::infinity());
+
+					m_extrema.push_back(index);
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < level_engine_exception > (logger, exception);
+				}
+			}
+
+			void Level_Engine::update_strength(std::size_t index)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto & bar = m_bars[index];
+
+					const auto price = bar.price_close;
+
+					const auto slack = 1.0 - 4.0 * std::numeric_limits < double > ::epsilon(); // note: rounding of ratios
+
+					auto price_min = (price > 0.0 && m_max_ratio < std::numeric_limits < double > ::infinity() ?
+						price / m_max_ratio * slack : -std::numeric_limits < double > ::infinity());
+
+					for (auto iterator = m_prices.lower_bound(price_min);
+						iterator != std::end(m_prices) && iterator->first <= price; ++iterator)
+					{
+						auto & level = m_levels[iterator->second];
+
+						if (level.price_high >= price && level.begin.to_timestamp() < bar.timestamp)
+						{
+							append_point(m_strength_points[iterator->second], level.strength_points, bar.timestamp);
+						}
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < level_engine_exception > (logger, exception);
+				}
+			}
+
+			void Level_Engine::update_weakness(std::size_t i, std::size_t j)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto price_i = m_bars[i].price_close;
+					const auto price_j = m_bars[j].price_close;
+
+					const auto timestamp = m_bars[i].timestamp;
+
+					indexes_container_t crossed_levels;
+
+					for (auto iterator = m_prices.lower_bound(std::min(price_i, price_j));
+						iterator != std::end(m_prices) && iterator->first <= std::max(price_i, price_j); ++iterator)
+					{
+						const auto & level = m_levels[iterator->second];
+
+						if (level.begin.to_timestamp() < timestamp && (
+							(price_i > level.price_high && price_j < level.price_low) ||
+							(price_i < level.price_low  && price_j > level.price_high)))
+						{
+							crossed_levels.push_back(iterator->second);
+						}
+					}
+
+					if (price_i > price_j) // note: levels crossed from above
+					{
+						std::sort(std::begin(crossed_levels), std::end(crossed_levels), [this](auto lhs, auto rhs)
+							{ return (m_levels[lhs].price_low > m_levels[rhs].price_low); });
+					}
+					else
+					{
+						std::sort(std::begin(crossed_levels), std::end(crossed_levels), [this](auto lhs, auto rhs)
+							{ return (m_levels[lhs].price_high < m_levels[rhs].price_high); });
+					}
+
+					auto k = i;
+
+					for (auto index : crossed_levels)
+					{
+						auto & level = m_levels[index];
+
+						while (price_i > price_j ?
+							!(m_bars[k].price_close < level.price_low) :
+							!(m_bars[k].price_close > level.price_high))
+						{
+							++k;
+						}
+
+						append_point(m_weakness_points[index], level.weakness_points, m_bars[k].timestamp);
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < level_engine_exception > (logger, exception);
+				}
+			}
+
+			void Level_Engine::append_point(const std::shared_ptr < Points::arena_t > & arena,
+				Level::points_container_t & points, timestamp_t timestamp) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					arena->push_back(timestamp); // note: append only, earlier views keep their ranges
+
+					points = Level::points_container_t(arena, 0U, std::size(*arena));
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < level_engine_exception > (logger, exception);
+				}
+			}
+
+			std::size_t Level_Engine::radius(std::size_t index, Candle::Type type) const noexcept
+			{
+				const auto & bar = m_bars[index];
+
+				const auto last = std::size(m_bars) - 1U;
+
+				const auto left  = (type == Candle::Type::local_min ? bar.left_min_radius  : bar.left_max_radius);
+				const auto right = (type == Candle::Type::local_min ? bar.right_min_radius : bar.right_max_radius);
+
+				return std::min(left, (right == npos ? last - index : right));
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,176 @@
+#ifndef SOLUTION_SYSTEM_MARKET_LEVEL_ENGINE_HPP
+#define SOLUTION_SYSTEM_MARKET_LEVEL_ENGINE_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../candle/candle.hpp"
+#include "../registry/registry.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class level_engine_exception : public std::exception
+			{
+			public:
+
+				explicit level_engine_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit level_engine_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~level_engine_exception() noexcept = default;
+			};
+
+			class Level_Engine // note: levels of an asset maintained bar by bar, same as on the whole chart
+			{
+			public:
+
+				using candles_container_t = std::vector < Candle > ;
+
+				using levels_container_t = std::vector < Level > ;
+
+				using timestamp_t = Date_Time::timestamp_t;
+
+				struct Parameters
+				{
+					std::size_t min_bias = 0U;
+					std::size_t max_bias = 0U;
+
+					double max_deviation = 0.0;
+				};
+
+			private:
+
+				struct Bar
+				{
+					Date_Time date_time;
+
+					timestamp_t timestamp = 0LL;
+
+					double price_low   = 0.0;
+					double price_high  = 0.0;
+					double price_close = 0.0;
+
+					double price = 0.0; // note: high + low + close
+
+					std::size_t left_min_radius = 0U;
+					std::size_t left_max_radius = 0U;
+
+					std::size_t right_min_radius = npos;
+					std::size_t right_max_radius = npos;
+
+					Candle::Type type = Candle::Type::empty;
+				};
+
+				using bars_container_t = std::vector < Bar > ;
+
+				using indexes_container_t = std::vector < std::size_t > ;
+
+				using prices_container_t = std::multimap < double, std::size_t > ;
+
+				using arenas_container_t = std::vector < std::shared_ptr < Points::arena_t > > ; // note: one growing arena per level
+
+			public:
+
+				Level_Engine(const candles_container_t & candles, levels_container_t & levels, const Parameters & parameters) :
+					m_levels(levels), m_registry(levels), m_parameters(parameters)
+				{
+					initialize(candles);
+				}
+
+				~Level_Engine() noexcept = default;
+
+			private:
+
+				void initialize(const candles_container_t & candles);
+
+			public:
+
+				static Level make_level(const Date_Time & begin, double typical_price,
+					std::size_t locality, Candle::Type type, double max_deviation);
+
+			public:
+
+				timestamp_t last_timestamp() const noexcept
+				{
+					return (std::empty(m_bars) ? std::numeric_limits < timestamp_t > ::min() : m_bars.back().timestamp);
+				}
+
+				void push(const Candle & candle);
+
+			private:
+
+				void push_bar(const Candle & candle);
+
+				void resolve_right_radii();
+
+				void update_levels();
+
+				void make_extremum(std::size_t index, std::size_t locality, Candle::Type type);
+
+				void update_strength(std::size_t index);
+
+				void update_weakness(std::size_t i, std::size_t j);
+
+				void append_point(const std::shared_ptr < Points::arena_t > & arena,
+					Level::points_container_t & points, timestamp_t timestamp) const;
+
+				std::size_t radius(std::size_t index, Candle::Type type) const noexcept;
+
+			private:
+
+				static inline const std::size_t npos = std::numeric_limits < std::size_t > ::max();
+
+			private:
+
+				levels_container_t & m_levels;
+
+				Registry m_registry;
+
+				const Parameters m_parameters;
+
+				bars_container_t m_bars;
+
+				indexes_container_t m_min_stack;
+				indexes_container_t m_max_stack;
+
+				indexes_container_t m_extrema;
+
+				prices_container_t m_prices; // note: levels by lower prices
+
+				double m_max_ratio = 1.0; // note: price_high <= price_low * max_ratio
+
+				arenas_container_t m_strength_points;
+				arenas_container_t m_weakness_points;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_LEVEL_ENGINE_HPP
\ No newline at end of file
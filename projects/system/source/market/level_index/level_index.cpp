@@ -0,0 +1,124 @@
+#include "level_index.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void Level_Index::initialize()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					m_activations.reserve(std::size(m_levels));
+
+					auto activation = std::numeric_limits < timestamp_t > ::min();
+
+					for (const auto & level : m_levels)
+					{
+						activation = std::max(activation, level.begin.to_timestamp() +
+							seconds_in_day * static_cast < timestamp_t > (level.locality));
+
+						m_activations.push_back(activation);
+
+						if (level.price_low > 0.0)
+						{
+							m_max_ratio = std::max(m_max_ratio, level.price_high / level.price_low);
+						}
+						else
+						{
+							m_max_ratio = std::numeric_limits < double > ::infinity();
+						}
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < level_index_exception > (logger, exception);
+				}
+			}
+
+			Level_Index::Result Level_Index::find(const Date_Time & date_time, double price)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					Result result;
+
+					activate(date_time.to_timestamp());
+
+					const auto slack = 1.0 - 4.0 * std::numeric_limits < double > ::epsilon(); // note: rounding of ratios
+
+					auto price_min = (price > 0.0 && m_max_ratio < std::numeric_limits < double > ::infinity() ?
+						price / m_max_ratio * slack : -std::numeric_limits < double > ::infinity());
+
+					for (auto iterator = m_active_levels.lower_bound(price_min);
+						iterator != std::end(m_active_levels) && iterator->first <= price;)
+					{
+						const auto & level = m_levels[iterator->second];
+
+						if (level.weakness_to_date(date_time) >= max_weakness)
+						{
+							iterator = m_active_levels.erase(iterator); // note: time does not go back until reset
+
+							continue;
+						}
+
+						if (level.price_high >= price)
+						{
+							++result.n_levels;
+
+							if (!result.level || result.level->locality < level.locality ||
+								(result.level->locality == level.locality && result.level > &level))
+							{
+								result.level = &level;
+							}
+						}
+
+						++iterator;
+					}
+
+					return result;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < level_index_exception > (logger, exception);
+				}
+			}
+
+			void Level_Index::activate(timestamp_t time)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (time < m_time)
+					{
+						m_active_levels.clear();
+
+						m_n_activated_levels = 0U;
+					}
+
+					m_time = time;
+
+					const auto n_levels = static_cast < std::size_t > (std::distance(std::begin(m_activations),
+						std::upper_bound(std::begin(m_activations), std::end(m_activations), time)));
+
+					for (; m_n_activated_levels < n_levels; ++m_n_activated_levels)
+					{
+						m_active_levels.emplace(m_levels[m_n_activated_levels].price_low, m_n_activated_levels);
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < level_index_exception > (logger, exception);
+				}
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
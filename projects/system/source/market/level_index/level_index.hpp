@@ -0,0 +1,114 @@
+#ifndef SOLUTION_SYSTEM_MARKET_LEVEL_INDEX_HPP
+#define SOLUTION_SYSTEM_MARKET_LEVEL_INDEX_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../candle/candle.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class level_index_exception : public std::exception
+			{
+			public:
+
+				explicit level_index_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit level_index_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~level_index_exception() noexcept = default;
+			};
+
+			class Level_Index // note: levels are active after begin + locality days up to the first inactive one
+			{
+			public:
+
+				using levels_container_t = std::vector < Level > ;
+
+				using timestamp_t = Date_Time::timestamp_t;
+
+				struct Result
+				{
+					std::size_t n_levels = 0U;
+
+					const Level * level = nullptr; // note: first level with maximum locality
+				};
+
+			private:
+
+				using activations_container_t = std::vector < timestamp_t > ;
+
+				using active_levels_container_t = std::multimap < double, std::size_t > ;
+
+			public:
+
+				explicit Level_Index(const levels_container_t & levels) : m_levels(levels)
+				{
+					initialize();
+				}
+
+				~Level_Index() noexcept = default;
+
+			private:
+
+				void initialize();
+
+			public:
+
+				Result find(const Date_Time & date_time, double price);
+
+			private:
+
+				void activate(timestamp_t time);
+
+			private:
+
+				static inline const timestamp_t seconds_in_day = 86400LL;
+
+				static inline const std::size_t max_weakness = 2U;
+
+			private:
+
+				const levels_container_t & m_levels;
+
+				activations_container_t m_activations; // note: prefix maxima of begin + locality days
+
+				active_levels_container_t m_active_levels;
+
+				std::size_t m_n_activated_levels = 0U;
+
+				timestamp_t m_time = std::numeric_limits < timestamp_t > ::min();
+
+				double m_max_ratio = 1.0; // note: price_high <= price_low * max_ratio
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_LEVEL_INDEX_HPP
\ No newline at end of file
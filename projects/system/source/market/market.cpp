@@ -295,47 +295,182 @@ namespace solution
 			}
 		}
 
-		void Market::Data::save_price_deviations(const charts_container_t & charts)
+		void Market::Data::save_self_similarities_binary(const self_similarities_container_t & self_similarities,
+			const scales_container_t & scales, bool is_float32)
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				auto path = File::price_deviations_data;
+				labels_container_t labels;
 
-				std::fstream fout(path.string(), std::ios::out | std::ios::trunc);
+				matrices_container_t matrices;
 
-				if (!fout)
+				for (const auto & [asset, matrix] : self_similarities)
 				{
-					throw market_exception("cannot open file " + path.string());
+					labels.push_back(asset);
+
+					matrices.push_back(&matrix);
 				}
 
-				std::ostringstream sout;
+				save_binary(File::self_similarities_binary, labels, scales, matrices, Binary::Layout::packed, is_float32);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
 
-				for (const auto & [asset, scales] : charts)
+		void Market::Data::save_pair_similarities_binary(const pair_similarities_container_t & pair_similarities,
+			const assets_container_t & assets, bool is_float32)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				labels_container_t labels;
+
+				matrices_container_t matrices;
+
+				for (const auto & [scale, matrix] : pair_similarities)
 				{
-					for (const auto & [scale, candles] : scales)
-					{
-						sout << asset << " " << scale << " " << std::size(candles) << "\n";
+					labels.push_back(scale);
 
-						std::for_each(std::begin(candles), std::end(candles), [&sout](const auto & candle)
-							{ 
-								static const char delimeter = ',';
+					matrices.push_back(&matrix);
+				}
+
+				save_binary(File::pair_similarities_binary, labels, assets, matrices, Binary::Layout::packed, is_float32);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
 
-								sout <<
-									candle.date_time.year   << delimeter << std::setfill('0') << std::setw(2) <<
-									candle.date_time.month  << delimeter << std::setfill('0') << std::setw(2) <<
-									candle.date_time.day    << delimeter;
+		void Market::Data::save_pair_correlations_binary(const pair_correlations_container_t & pair_correlations,
+			const assets_container_t & assets, bool is_float32)
+		{
+			RUN_LOGGER(logger);
 
-								sout << std::setprecision(6) << std::fixed << std::showpos <<
-									candle.price_deviation << "\n";
-							});
+			try
+			{
+				labels_container_t labels;
 
-						sout << "\n";
-					}
+				matrices_container_t matrices;
+
+				for (const auto & [scale, matrix] : pair_correlations)
+				{
+					labels.push_back(scale);
+
+					matrices.push_back(&matrix);
 				}
 
-				fout << sout.str();
+				save_binary(File::pair_correlations_binary, labels, assets, matrices, Binary::Layout::packed, is_float32);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::save_cumulative_distances_binary(const distances_matrix_t & matrix,
+			const std::string & label, bool is_float32)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				save_binary(File::cumulative_distances_binary, { label }, {}, { &matrix }, Binary::Layout::dense, is_float32);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::load_self_similarities_cache(Cache & cache)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				load_cache(File::self_similarities_cache, File::self_similarities_fingerprints, cache);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::load_pair_similarities_cache(Cache & cache)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				load_cache(File::pair_similarities_cache, File::pair_similarities_fingerprints, cache);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::load_pair_correlations_cache(Cache & cache)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				load_cache(File::pair_correlations_cache, File::pair_correlations_fingerprints, cache);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::save_self_similarities_cache(const self_similarities_container_t & self_similarities,
+			const scales_container_t & scales, const json_t & fingerprints)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				save_cache(File::self_similarities_cache, File::self_similarities_fingerprints,
+					self_similarities, scales, fingerprints);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::save_pair_similarities_cache(const pair_similarities_container_t & pair_similarities,
+			const assets_container_t & assets, const json_t & fingerprints)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				save_cache(File::pair_similarities_cache, File::pair_similarities_fingerprints,
+					pair_similarities, assets, fingerprints);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::save_pair_correlations_cache(const pair_correlations_container_t & pair_correlations,
+			const assets_container_t & assets, const json_t & fingerprints)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				save_cache(File::pair_correlations_cache, File::pair_correlations_fingerprints,
+					pair_correlations, assets, fingerprints);
 			}
 			catch (const std::exception & exception)
 			{
@@ -343,20 +478,44 @@ namespace solution
 			}
 		}
 
-		unsigned int day_of_week(const market::Candle & candle)
+		void Market::Data::save_price_deviations(const charts_container_t & charts, Executor & executor)
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				std::tm tm = { 0, 0, 0,
-					static_cast < int > (candle.date_time.day),
-					static_cast < int > (candle.date_time.month) - 1,
-					static_cast < int > (candle.date_time.year)  - 1900 };
+				std::vector < std::tuple < const std::string *, const std::string *, const candles_container_t * > > blocks;
+
+				for (const auto & [asset, scales] : charts)
+				{
+					for (const auto & [scale, candles] : scales)
+					{
+						blocks.emplace_back(&asset, &scale, &candles);
+					}
+				}
+
+				Writer(executor).write(File::price_deviations_data, std::size(blocks), [&blocks](auto index, auto & buffer)
+					{
+						const auto & [asset, scale, candles] = blocks[index];
+
+						const auto delimeter = ',';
+
+						buffer = Buffer(std::size(*candles) * 24U + 64U);
+
+						buffer.append(*asset).append(' ').append(*scale).append(' ').append(
+							static_cast < unsigned long long > (std::size(*candles))).append('\n');
+
+						for (const auto & candle : *candles)
+						{
+							buffer.append(static_cast < unsigned long long > (candle.date_time.year)).append(delimeter);
+							buffer.append(static_cast < unsigned long long > (candle.date_time.month), 2U).append(delimeter);
+							buffer.append(static_cast < unsigned long long > (candle.date_time.day),   2U).append(delimeter);
 
-				auto time = std::mktime(&tm);
+							buffer.append(candle.price_deviation, 6, true).append('\n');
+						}
 
-				return static_cast < unsigned int > (std::localtime(&time)->tm_wday) - 1U;
+						buffer.append('\n');
+					});
 			}
 			catch (const std::exception & exception)
 			{
@@ -410,7 +569,7 @@ namespace solution
 								sout << std::setprecision(3) << std::fixed << std::noshowpos <<
 									candle.date_time.day / days_in_month << delimeter;
 
-								const auto day = day_of_week(candle);
+								const auto day = Calendar::weekday(candle.date_time);
 
 								for (auto j = 0U; j < 5U; ++j)
 								{
@@ -495,135 +654,126 @@ namespace solution
 			}
 		}
 
-		void Market::Data::save_environment(const charts_container_t & charts, const Config & config)
+		void Market::Data::save_environment(const charts_container_t & charts, const calendars_container_t & calendars,
+			const Config & config, Executor & executor)
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				auto path = File::environment_data;
-
-				std::fstream fout(path.string(), std::ios::out);
+				std::vector < std::pair < const std::string *, const charts_container_t::mapped_type * > > blocks;
 
-				if (!fout)
+				for (const auto & [asset, scales] : charts)
 				{
-					throw market_exception("cannot open file " + path.string());
+					blocks.emplace_back(&asset, &scales);
 				}
 
-				fout.close();
+				Writer(executor).write(File::environment_data, std::size(blocks), [&blocks, &calendars, &config](auto index, auto & buffer)
+					{
+						const auto delimeter = ',';
 
-				const auto delimeter = ',';
+						for (const auto & [scale, candles] : *blocks[index].second)
+						{
+							const auto price_deviation_multiplier = 
+								Market::get_price_deviation_multiplier(scale);
 
-				for (const auto & [asset, scales] : charts)
-				{
-					std::ostringstream sout;
+							const auto & calendar = calendars.at(*blocks[index].first).at(scale);
 
-					for (const auto & [scale, candles] : scales)
-					{
-						const auto price_deviation_multiplier = 
-							Market::get_price_deviation_multiplier(scale);
+							const auto [first, last] = (config.required_test_data ?
+								calendar.rows_since(config.test_data_start) : calendar.rows_before(config.test_data_start));
 
-						for (auto i = config.skipped_timesteps + 1U; i < std::size(candles); ++i)
-						{
-							if (((candles[i].date_time.year >= config.test_data_start &&  config.required_test_data)  ||
-								 (candles[i].date_time.year  < config.test_data_start && !config.required_test_data)) &&
-								 (candles[i - 1U].n_levels != 0U && candles[i].n_levels == 0U))
+							for (auto i = std::max(first, config.skipped_timesteps + 1U); i < last; ++i)
 							{
-								auto price_deviation = price_deviation_multiplier *
-									(candles[i].price_deviation + candles[i].price_deviation_open);
+								if (candles[i - 1U].n_levels != 0U && candles[i].n_levels == 0U)
+								{
+									auto price_deviation = price_deviation_multiplier *
+										(candles[i].price_deviation + candles[i].price_deviation_open);
 
-								sout << candles[i].date_time << delimeter;
+									format(buffer, candles[i].date_time); buffer.append(delimeter);
 
-								sout << std::setprecision(3) << std::fixed << std::showpos <<
-									std::min(std::max(price_deviation, -1.0), +1.0) << delimeter;
+									buffer.append(std::min(std::max(price_deviation, -1.0), +1.0), 3, true).append(delimeter);
 
-								sout << std::setprecision(3) << std::fixed << std::noshowpos <<
-									1.0 * candles[i - 1U].level.locality / config.level_max_bias << delimeter;
+									buffer.append(1.0 * candles[i - 1U].level.locality / config.level_max_bias, 3, false).append(delimeter);
 
-								sout << std::setprecision(3) << std::fixed << std::noshowpos <<
-									std::min(candles[i - 1U].level.strength_to_date(candles[i - 1U].date_time) / 
-										config.level_max_strength, 1.0) << delimeter;
+									buffer.append(std::min(candles[i - 1U].level.strength_to_date(candles[i - 1U].date_time) / 
+										config.level_max_strength, 1.0), 3, false).append(delimeter);
 
-								sout << std::noshowpos << candles[i - 1U].level.weakness_to_date(
-									candles[i - 1U].date_time) << delimeter;
+									buffer.append(static_cast < unsigned long long > (candles[i - 1U].level.weakness_to_date(
+										candles[i - 1U].date_time))).append(delimeter);
 
-								/*
-								for (auto k = 0U; k < std::size(candles[i].indicators); ++k)
-								{
-									auto price = std::max(candles[i].price_close, epsilon);
+									/*
+									for (auto k = 0U; k < std::size(candles[i].indicators); ++k)
+									{
+										auto price = std::max(candles[i].price_close, epsilon);
 
-									auto deviation = (candles[i].indicators[k] - price) / price;
+										auto deviation = (candles[i].indicators[k] - price) / price;
 
-									sout << std::setprecision(3) << std::fixed << std::showpos <<
-										std::min(std::max(deviation, -1.0), +1.0) << delimeter;
-								}
+										sout << std::setprecision(3) << std::fixed << std::showpos <<
+											std::min(std::max(deviation, -1.0), +1.0) << delimeter;
+									}
 
-								for (auto k = 0U; k < std::size(candles[i].oscillators); ++k)
-								{
-									sout << std::setprecision(3) << std::fixed << std::showpos <<
-										candles[i].oscillators[k] << delimeter;
-								}
-								*/
+									for (auto k = 0U; k < std::size(candles[i].oscillators); ++k)
+									{
+										sout << std::setprecision(3) << std::fixed << std::showpos <<
+											candles[i].oscillators[k] << delimeter;
+									}
+									*/
 																
-								/*
-								for (auto j = 0U; j < config.prediction_timesteps; ++j)
-								{
-									const auto & candle = candles[i - j];
+									/*
+									for (auto j = 0U; j < config.prediction_timesteps; ++j)
+									{
+										const auto & candle = candles[i - j];
 
-									auto price_deviation_1 = candle.price_deviation_open * price_deviation_multiplier;
-									auto price_deviation_2 = candle.price_deviation      * price_deviation_multiplier;
-									auto price_deviation_3 = candle.price_deviation_max  * price_deviation_multiplier;
-									auto price_deviation_4 = candle.price_deviation_min  * price_deviation_multiplier;
+										auto price_deviation_1 = candle.price_deviation_open * price_deviation_multiplier;
+										auto price_deviation_2 = candle.price_deviation      * price_deviation_multiplier;
+										auto price_deviation_3 = candle.price_deviation_max  * price_deviation_multiplier;
+										auto price_deviation_4 = candle.price_deviation_min  * price_deviation_multiplier;
 
-									sout << std::setprecision(3) << std::fixed << std::showpos <<
-										std::min(std::max(price_deviation_1, -1.0), +1.0) << delimeter;
-									sout << std::setprecision(3) << std::fixed << std::showpos <<
-										std::min(std::max(price_deviation_2, -1.0), +1.0) << delimeter;
-									sout << std::setprecision(3) << std::fixed << std::showpos <<
-										std::min(std::max(price_deviation_3, +0.0), +1.0) << delimeter;
-									sout << std::setprecision(3) << std::fixed << std::showpos <<
-										std::min(std::max(price_deviation_3, +0.0), +1.0) << delimeter;
+										sout << std::setprecision(3) << std::fixed << std::showpos <<
+											std::min(std::max(price_deviation_1, -1.0), +1.0) << delimeter;
+										sout << std::setprecision(3) << std::fixed << std::showpos <<
+											std::min(std::max(price_deviation_2, -1.0), +1.0) << delimeter;
+										sout << std::setprecision(3) << std::fixed << std::showpos <<
+											std::min(std::max(price_deviation_3, +0.0), +1.0) << delimeter;
+										sout << std::setprecision(3) << std::fixed << std::showpos <<
+											std::min(std::max(price_deviation_3, +0.0), +1.0) << delimeter;
 
-									auto volume_deviation = candles[i].volume_deviation;
+										auto volume_deviation = candles[i].volume_deviation;
 
-									sout << std::setprecision(3) << std::fixed << std::showpos <<
-										std::min(std::max(volume_deviation, -1.0), +1.0) << delimeter;
+										sout << std::setprecision(3) << std::fixed << std::showpos <<
+											std::min(std::max(volume_deviation, -1.0), +1.0) << delimeter;
 
-									auto price = std::max(candles[i].price_close, epsilon);
+										auto price = std::max(candles[i].price_close, epsilon);
 
-									for (auto k = 0U; k < std::size(candle.indicators); ++k)
-									{
-										auto deviation = (candle.indicators[k] - price) / price;
+										for (auto k = 0U; k < std::size(candle.indicators); ++k)
+										{
+											auto deviation = (candle.indicators[k] - price) / price;
 
-										sout << std::setprecision(3) << std::fixed << std::showpos <<
-											std::min(std::max(deviation, -1.0), +1.0) << delimeter;
-									}
+											sout << std::setprecision(3) << std::fixed << std::showpos <<
+												std::min(std::max(deviation, -1.0), +1.0) << delimeter;
+										}
 
-									for (auto k = 0U; k < std::size(candle.oscillators); ++k)
-									{
-										sout << std::setprecision(3) << std::fixed << std::showpos <<
-											candle.oscillators[k] << delimeter;
+										for (auto k = 0U; k < std::size(candle.oscillators); ++k)
+										{
+											sout << std::setprecision(3) << std::fixed << std::showpos <<
+												candle.oscillators[k] << delimeter;
+										}
 									}
-								}
-								*/
+									*/
 
-								/*
-								auto regression_tag = std::min(
-									candles[i].regression_tags[config.movement_timesteps - 1U], 1.0);
+									/*
+									auto regression_tag = std::min(
+										candles[i].regression_tags[config.movement_timesteps - 1U], 1.0);
 
-								sout << std::setprecision(3) << std::fixed << std::showpos <<
-									regression_tag << delimeter;
-								*/
+									sout << std::setprecision(3) << std::fixed << std::showpos <<
+										regression_tag << delimeter;
+									*/
 
-								sout << std::showpos << candles[i].movement_tag << "\n";
+									buffer.append(static_cast < long long > (candles[i].movement_tag), true).append('\n');
+								}
 							}
 						}
-					}
-
-					std::fstream fout(path.string(), std::ios::out | std::ios::app);
-
-					fout << sout.str();
-				}
+					});
 			}
 			catch (const std::exception & exception)
 			{
@@ -631,36 +781,35 @@ namespace solution
 			}
 		}
 
-		void Market::Data::save_supports_resistances(const supports_resistances_container_t & supports_resistances)
+		void Market::Data::save_supports_resistances(const supports_resistances_container_t & supports_resistances, Executor & executor)
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				auto path = File::supports_resistances_data;
-
-				std::fstream fout(path.string(), std::ios::out | std::ios::trunc);
+				std::vector < std::pair < const std::string *, const levels_container_t * > > blocks;
 
-				if (!fout)
+				for (const auto & [asset, levels] : supports_resistances)
 				{
-					throw market_exception("cannot open file " + path.string());
+					blocks.emplace_back(&asset, &levels);
 				}
 
-				std::ostringstream sout;
+				Writer(executor).write(File::supports_resistances_data, std::size(blocks), [&blocks](auto index, auto & buffer)
+					{
+						const auto & [asset, levels] = blocks[index];
 
-				for (const auto & [asset, levels] : supports_resistances)
-				{
-					sout << asset << " " << std::size(levels) << "\n\n";
+						buffer = Buffer(std::size(*levels) * 48U + 64U);
 
-					for (const auto & level : levels)
-					{
-						sout << level << "\n";
-					}
+						buffer.append(*asset).append(' ').append(
+							static_cast < unsigned long long > (std::size(*levels))).append("\n\n");
 
-					sout << "\n";
-				}
+						for (const auto & level : *levels)
+						{
+							format(buffer, level); buffer.append('\n');
+						}
 
-				fout << sout.str();
+						buffer.append('\n');
+					});
 			}
 			catch (const std::exception & exception)
 			{
@@ -668,20 +817,74 @@ namespace solution
 			}
 		}
 
-		void Market::Data::load(const path_t & path, json_t & object)
+		void Market::Data::save_environment_dataset(const charts_container_t & charts, const calendars_container_t & calendars,
+			const assets_container_t & assets, const scales_container_t & scales, const Config & config)
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				std::fstream fin(path.string(), std::ios::in);
+				Dataset dataset({ "price_deviation", "locality", "strength", "weakness" }, config.regression_horizons);
 
-				if (!fin)
+				Dataset::Row row;
+
+				for (auto i = 0U; i < std::size(assets); ++i)
 				{
-					throw market_exception("cannot open file " + path.string());
+					if (charts.count(assets[i]) == 0U)
+					{
+						continue;
+					}
+
+					const auto & chart = charts.at(assets[i]);
+
+					for (auto j = 0U; j < std::size(scales); ++j)
+					{
+						if (chart.count(scales[j]) == 0U)
+						{
+							continue;
+						}
+
+						const auto & candles = chart.at(scales[j]);
+
+						const auto & calendar = calendars.at(assets[i]).at(scales[j]);
+
+						const auto price_deviation_multiplier = Market::get_price_deviation_multiplier(scales[j]);
+
+						row.asset = static_cast < std::int32_t > (i);
+						row.scale = static_cast < std::int32_t > (j);
+
+						for (auto is_test : { false, true })
+						{
+							const auto [first, last] = (is_test ?
+								calendar.rows_since(config.test_data_start) : calendar.rows_before(config.test_data_start));
+
+							for (auto k = std::max(first, config.skipped_timesteps + 1U); k < last; ++k)
+							{
+								if (candles[k - 1U].n_levels != 0U && candles[k].n_levels == 0U) // note: as environment.data
+								{
+									const auto & level = candles[k - 1U].level;
+
+									auto price_deviation = price_deviation_multiplier *
+										(candles[k].price_deviation + candles[k].price_deviation_open);
+
+									row.features.clear();
+
+									row.features.push_back(static_cast < float > (std::min(std::max(price_deviation, -1.0), +1.0)));
+									row.features.push_back(static_cast < float > (1.0 * level.locality / config.level_max_bias));
+									row.features.push_back(static_cast < float > (std::min(level.strength_to_date(
+										candles[k - 1U].date_time) / config.level_max_strength, 1.0)));
+									row.features.push_back(static_cast < float > (level.weakness_to_date(candles[k - 1U].date_time)));
+
+									make_labels(row, candles[k], is_test);
+
+									dataset.push_back(row);
+								}
+							}
+						}
+					}
 				}
 
-				object = json_t::parse(fin);
+				dataset.save(File::environment_dataset, make_metadata(assets, scales));
 			}
 			catch (const std::exception & exception)
 			{
@@ -689,7 +892,177 @@ namespace solution
 			}
 		}
 
-		void Market::Data::save(const path_t & path, const json_t & object)
+		void Market::Data::save_tagged_charts_dataset(const charts_container_t & charts, const calendars_container_t & calendars,
+			const assets_container_t & assets, const scales_container_t & scales, const Config & config)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				std::size_t n_indicators  = 0U;
+				std::size_t n_oscillators = 0U;
+
+				for (const auto & [asset, chart] : charts)
+				{
+					for (const auto & [scale, candles] : chart)
+					{
+						if (!candles.empty())
+						{
+							n_indicators  = std::size(candles.front().indicators);
+							n_oscillators = std::size(candles.front().oscillators);
+						}
+					}
+				}
+
+				Dataset::names_container_t names = { "price_deviation_open", "price_deviation",
+					"price_deviation_max", "price_deviation_min", "volume_deviation", "n_levels" };
+
+				for (auto k = 0U; k < n_indicators; ++k)
+				{
+					names.push_back("indicator_" + std::to_string(k));
+				}
+
+				for (auto k = 0U; k < n_oscillators; ++k)
+				{
+					names.push_back("oscillator_" + std::to_string(k));
+				}
+
+				Dataset dataset(names, config.regression_horizons);
+
+				Dataset::Row row;
+
+				for (auto i = 0U; i < std::size(assets); ++i)
+				{
+					if (charts.count(assets[i]) == 0U)
+					{
+						continue;
+					}
+
+					const auto & chart = charts.at(assets[i]);
+
+					for (auto j = 0U; j < std::size(scales); ++j)
+					{
+						if (chart.count(scales[j]) == 0U)
+						{
+							continue;
+						}
+
+						const auto & candles = chart.at(scales[j]);
+
+						const auto & calendar = calendars.at(assets[i]).at(scales[j]);
+
+						row.asset = static_cast < std::int32_t > (i);
+						row.scale = static_cast < std::int32_t > (j);
+
+						for (auto is_test : { false, true })
+						{
+							for (const auto & candle : Calendar::view(candles, (is_test ?
+								calendar.rows_since(config.test_data_start) : calendar.rows_before(config.test_data_start))))
+							{
+								row.features.clear();
+
+								row.features.push_back(static_cast < float > (candle.price_deviation_open));
+								row.features.push_back(static_cast < float > (candle.price_deviation));
+								row.features.push_back(static_cast < float > (candle.price_deviation_max));
+								row.features.push_back(static_cast < float > (candle.price_deviation_min));
+								row.features.push_back(static_cast < float > (candle.volume_deviation));
+								row.features.push_back(static_cast < float > (candle.n_levels));
+
+								row.features.insert(std::end(row.features),
+									std::begin(candle.indicators), std::end(candle.indicators));
+								row.features.insert(std::end(row.features),
+									std::begin(candle.oscillators), std::end(candle.oscillators));
+
+								make_labels(row, candle, is_test);
+
+								dataset.push_back(row);
+							}
+						}
+					}
+				}
+
+				dataset.save(File::tagged_charts_dataset, make_metadata(assets, scales));
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::save_environment_index(const HNSW_Index & index)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				index.save(File::environment_index);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::load_environment_index(HNSW_Index & index)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				index.load(File::environment_index);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::format(Buffer & buffer, const Date_Time & date_time) // note: as operator<<
+		{
+			const auto delimeter = '/';
+
+			buffer.append(static_cast < unsigned long long > (date_time.year),  4U).append(delimeter);
+			buffer.append(static_cast < unsigned long long > (date_time.month), 2U).append(delimeter);
+			buffer.append(static_cast < unsigned long long > (date_time.day),   2U);
+		}
+
+		void Market::Data::format(Buffer & buffer, const Level & level) // note: as operator<<
+		{
+			const auto delimeter = ',';
+
+			format(buffer, level.begin); buffer.append(delimeter);
+
+			buffer.append(level.price_low,  6, false).append(delimeter);
+			buffer.append(level.price_high, 6, false).append(delimeter);
+
+			buffer.append(static_cast < unsigned long long > (level.locality), 3U).append(delimeter);
+
+			buffer.append(static_cast < unsigned long long > (std::size(level.strength_points))).append(delimeter);
+			buffer.append(static_cast < unsigned long long > (std::size(level.weakness_points)));
+		}
+
+		void Market::Data::load(const path_t & path, json_t & object)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				std::fstream fin(path.string(), std::ios::in);
+
+				if (!fin)
+				{
+					throw market_exception("cannot open file " + path.string());
+				}
+
+				object = json_t::parse(fin);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::save(const path_t & path, const json_t & object)
 		{
 			RUN_LOGGER(logger);
 
@@ -710,6 +1083,362 @@ namespace solution
 			}
 		}
 
+		void Market::Data::make_labels(Dataset::Row & row, const Candle & candle, bool is_test)
+		{
+			row.is_test = is_test;
+
+			row.timestamp = candle.date_time.to_timestamp();
+
+			row.movement_tag = static_cast < std::int8_t > (candle.movement_tag);
+
+			row.regression_tags.assign(std::begin(candle.regression_tags), std::end(candle.regression_tags));
+
+			row.classification_tag = static_cast < std::uint8_t > (candle.classification_tag);
+		}
+
+		Market::Data::json_t Market::Data::make_metadata(const assets_container_t & assets, const scales_container_t & scales)
+		{
+			auto metadata = json_t::object();
+
+			metadata["assets"] = assets;
+			metadata["scales"] = scales;
+
+			return metadata;
+		}
+
+		void Market::Data::save_binary(const path_t & path, const labels_container_t & labels,
+			const labels_container_t & axis_labels, const matrices_container_t & matrices,
+			Binary::Layout layout, bool is_float32)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				std::uint64_t n_rows    = (std::empty(matrices) ? 0U : matrices.front()->shape()[0]);
+				std::uint64_t n_columns = (std::empty(matrices) ? 0U : matrices.front()->shape()[1]);
+
+				for (auto matrix : matrices)
+				{
+					if (matrix->shape()[0] != n_rows || matrix->shape()[1] != n_columns)
+					{
+						throw market_exception("inconsistent matrix shapes in " + path.string());
+					}
+				}
+
+				if (layout == Binary::Layout::packed && n_rows != n_columns)
+				{
+					throw market_exception("cannot pack non-square matrices in " + path.string());
+				}
+
+				std::ostringstream sout(std::ios::out | std::ios::binary);
+
+				auto write = [&sout](auto value)
+				{
+					sout.write(reinterpret_cast < const char * > (&value), sizeof(value));
+				};
+
+				auto write_labels = [&sout, &write](const labels_container_t & labels)
+				{
+					write(static_cast < std::uint64_t > (std::size(labels)));
+
+					for (const auto & label : labels)
+					{
+						write(static_cast < std::uint32_t > (std::size(label)));
+
+						sout.write(label.data(), std::size(label));
+					}
+				};
+
+				sout.write(Binary::magic.data(), std::size(Binary::magic));
+
+				write(Binary::version);
+				write(static_cast < std::uint32_t > (layout));
+				write(static_cast < std::uint32_t > (is_float32 ? sizeof(float) : sizeof(double)));
+				write(Binary::byte_order);
+
+				write(static_cast < std::uint64_t > (std::size(matrices)));
+				write(n_rows);
+				write(n_columns);
+
+				auto header_size_position = sout.tellp();
+
+				write(static_cast < std::uint64_t > (0U));
+
+				write_labels(labels);
+				write_labels(axis_labels);
+
+				auto padding = (Binary::alignment - static_cast < std::size_t > (sout.tellp()) % Binary::alignment) % Binary::alignment;
+
+				sout << std::string(padding, '\0');
+
+				auto header_size = static_cast < std::uint64_t > (sout.tellp());
+
+				sout.seekp(header_size_position);
+
+				write(header_size);
+
+				sout.seekp(0, std::ios::end);
+
+				for (auto matrix : matrices)
+				{
+					if (is_float32)
+					{
+						write_matrix < float > (sout, *matrix, layout);
+					}
+					else
+					{
+						write_matrix < double > (sout, *matrix, layout);
+					}
+				}
+
+				std::fstream fout(path.string(), std::ios::out | std::ios::trunc | std::ios::binary);
+
+				if (!fout)
+				{
+					throw market_exception("cannot open file " + path.string());
+				}
+
+				fout << sout.str();
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		template < typename T >
+		void Market::Data::write_matrix(std::ostream & stream, const matrix_t & matrix, Binary::Layout layout)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				const auto n_rows    = matrix.shape()[0];
+				const auto n_columns = matrix.shape()[1];
+
+				std::vector < T > row;
+
+				row.reserve(n_columns);
+
+				for (auto i = 0U; i < n_rows; ++i)
+				{
+					row.clear();
+
+					for (auto j = (layout == Binary::Layout::packed ? i : 0U); j < n_columns; ++j)
+					{
+						row.push_back(static_cast < T > (matrix[i][j]));
+					}
+
+					stream.write(reinterpret_cast < const char * > (row.data()), std::size(row) * sizeof(T));
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::load_binary(const path_t & path, labels_container_t & labels,
+			labels_container_t & axis_labels, std::vector < matrix_t > & matrices)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				std::fstream fin(path.string(), std::ios::in | std::ios::binary);
+
+				if (!fin)
+				{
+					throw market_exception("cannot open file " + path.string());
+				}
+
+				fin.exceptions(std::ios::failbit | std::ios::badbit);
+
+				auto read = [&fin](auto & value)
+				{
+					fin.read(reinterpret_cast < char * > (&value), sizeof(value));
+				};
+
+				auto read_labels = [&fin, &read](labels_container_t & labels)
+				{
+					std::uint64_t n_labels = 0U;
+
+					read(n_labels);
+
+					labels.resize(n_labels);
+
+					for (auto & label : labels)
+					{
+						std::uint32_t length = 0U;
+
+						read(length);
+
+						label.resize(length);
+
+						fin.read(label.data(), length);
+					}
+				};
+
+				std::string magic(std::size(Binary::magic), '\0');
+
+				fin.read(magic.data(), std::size(magic));
+
+				std::uint32_t version = 0U, layout = 0U, element_size = 0U, byte_order = 0U;
+
+				read(version);
+				read(layout);
+				read(element_size);
+				read(byte_order);
+
+				if (magic == Binary::magic && byte_order != Binary::byte_order)
+				{
+					throw market_exception("foreign byte order in file " + path.string());
+				}
+
+				if (magic != Binary::magic || version != Binary::version)
+				{
+					throw market_exception("unknown format of file " + path.string());
+				}
+
+				std::uint64_t n_matrices = 0U, n_rows = 0U, n_columns = 0U, header_size = 0U;
+
+				read(n_matrices);
+				read(n_rows);
+				read(n_columns);
+				read(header_size);
+
+				read_labels(labels);
+				read_labels(axis_labels);
+
+				fin.seekg(header_size);
+
+				matrices.assign(n_matrices, matrix_t(boost::extents[n_rows][n_columns]));
+
+				for (auto & matrix : matrices)
+				{
+					switch (element_size)
+					{
+					case sizeof(float):
+					{
+						read_matrix < float > (fin, matrix, static_cast < Binary::Layout > (layout));
+						break;
+					}
+					case sizeof(double):
+					{
+						read_matrix < double > (fin, matrix, static_cast < Binary::Layout > (layout));
+						break;
+					}
+					default:
+					{
+						throw market_exception("unknown element size in file " + path.string());
+					}
+					}
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		template < typename T >
+		void Market::Data::read_matrix(std::istream & stream, matrix_t & matrix, Binary::Layout layout)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				const auto n_rows    = matrix.shape()[0];
+				const auto n_columns = matrix.shape()[1];
+
+				std::vector < T > row(n_columns);
+
+				for (auto i = 0U; i < n_rows; ++i)
+				{
+					const auto first = (layout == Binary::Layout::packed ? i : 0U);
+
+					stream.read(reinterpret_cast < char * > (row.data()), (n_columns - first) * sizeof(T));
+
+					for (auto j = first; j < n_columns; ++j)
+					{
+						matrix[i][j] = static_cast < double > (row[j - first]);
+
+						if (layout == Binary::Layout::packed)
+						{
+							matrix[j][i] = matrix[i][j];
+						}
+					}
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::Data::load_cache(const path_t & matrices_path, const path_t & fingerprints_path, Cache & cache)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				if (!std::filesystem::exists(matrices_path) || !std::filesystem::exists(fingerprints_path))
+				{
+					return;
+				}
+
+				load(fingerprints_path, cache.fingerprints);
+
+				load_binary(matrices_path, cache.labels, cache.axis_labels, cache.matrices);
+
+				if (std::size(cache.labels) != std::size(cache.matrices))
+				{
+					throw market_exception("inconsistent labels in file " + matrices_path.string());
+				}
+
+				for (const auto & matrix : cache.matrices)
+				{
+					if (matrix.shape()[0] != std::size(cache.axis_labels) || matrix.shape()[1] != std::size(cache.axis_labels))
+					{
+						throw market_exception("inconsistent axis labels in file " + matrices_path.string());
+					}
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		template < typename Container >
+		void Market::Data::save_cache(const path_t & matrices_path, const path_t & fingerprints_path,
+			const Container & container, const labels_container_t & axis_labels, const json_t & fingerprints)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				labels_container_t labels;
+
+				matrices_container_t matrices;
+
+				for (const auto & [label, matrix] : container)
+				{
+					labels.push_back(label);
+
+					matrices.push_back(&matrix);
+				}
+
+				save_binary(matrices_path, labels, axis_labels, matrices, Binary::Layout::packed, false);
+
+				save(fingerprints_path, fingerprints);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
 		void Market::initialize()
 		{
 			RUN_LOGGER(logger);
@@ -719,82 +1448,194 @@ namespace solution
 				std::filesystem::create_directory(charts_directory);
 				std::filesystem::create_directory(levels_directory);
 				std::filesystem::create_directory(output_directory);
+				std::filesystem::create_directory(cache_directory);
+
+				make_pipeline();
+
+				const auto targets = make_targets();
+
+				if (m_config.required_dry_run)
+				{
+					m_pipeline.report(std::cout, targets);
+
+					return;
+				}
+
+				for (const auto & target : targets)
+				{
+					m_pipeline.run(target);
+				}
+
+				if (m_config.required_local_environment && m_config.run_local_environment_test)
+				{
+					run_local_environment_test();
+				}
+
+				if (m_config.required_local_environment && m_config.run_knn_benchmark)
+				{
+					run_knn_benchmark();
+				}
+
+				if (m_config.run_fridays_test)
+				{
+					run_fridays_test();
+				}
+
+				if (m_config.run_mornings_test)
+				{
+					run_mornings_test();
+				}
+
+				if (m_config.run_intraday_test)
+				{
+					run_intraday_test();
+				}
+
+				if (m_config.run_event_study)
+				{
+					run_event_study();
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::uninitialize()
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				// the executor is process-wide and outlives the market
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::make_pipeline()
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				const auto action = [this](Pipeline::action_t function) // note: produced by charts in dataflow mode
+				{
+					return (m_config.required_dataflow ? Pipeline::action_t() : function);
+				};
+
+				m_pipeline.add(Stage::charts, {},
+					{ "assets", "scales", "limits", "indicators", "oscillators", "charts" },
+					[this]() { load(); });
+
+				m_pipeline.add(Stage::self_similarities, { Stage::charts },
+					{ "self_similarities" }, action([this]() { handle_self_similarities(); }));
+
+				m_pipeline.add(Stage::pair_similarities, { Stage::charts },
+					{ "pair_similarities" }, action([this]() { handle_pair_similarities(); }));
+
+				m_pipeline.add(Stage::pair_correlations, { Stage::charts },
+					{ "pair_correlations" }, action([this]() { handle_pair_correlations(); }));
+
+				m_pipeline.add(Stage::price_deviations, { Stage::charts },
+					{ "price_deviations.data" }, [this]() { handle_price_deviations(); });
+
+				m_pipeline.add(Stage::supports_resistances, { Stage::charts },
+					{ "supports_resistances" }, action([this]() { make_supports_resistances(); }));
+
+				m_pipeline.add(Stage::levels_output, { Stage::supports_resistances },
+					{ "supports_resistances.data" }, [this]() { save_supports_resistances(); });
+
+				m_pipeline.add(Stage::tags, { Stage::charts, Stage::supports_resistances },
+					{ "regression_tags", "classification_tags", "movement_tags", "levels", "indicators", "oscillators" },
+					action([this]() { make_tagged_charts(); }));
+
+				m_pipeline.add(Stage::tagged_charts, { Stage::tags },
+					{ "tagged_charts.data" }, [this]() { save_tagged_charts(); });
+
+				m_pipeline.add(Stage::environment, { Stage::tags },
+					{ "environment.data" }, [this]() { save_environment(); });
+
+				m_pipeline.add(Stage::local_environment, { Stage::tags },
+					{ "environment" }, [this]() { make_local_environment(); });
+
+				m_pipeline.add(Stage::dataset, { Stage::tags },
+					{ "environment/*.npy", "tagged_charts/*.npy" }, [this]() { save_dataset(); });
+
+				m_pipeline.add(Stage::sources, {}, { "sources", "level_engines" }, [this]()
+					{
+						initialize_sources();
+
+						update_supports_resistances();
+					});
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		Market::Pipeline::names_container_t Market::make_targets() const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				Pipeline::names_container_t targets;
 
-				load();
+				targets.push_back(Stage::charts);
 
 				if (m_config.required_self_similarities)
 				{
-					handle_self_similarities();
+					targets.push_back(Stage::self_similarities);
 				}
 
 				if (m_config.required_pair_similarities)
 				{
-					handle_pair_similarities();
+					targets.push_back(Stage::pair_similarities);
 				}
 
 				if (m_config.required_pair_correlations)
 				{
-					handle_pair_correlations();
+					targets.push_back(Stage::pair_correlations);
 				}
 
 				if (m_config.required_price_deviations)
 				{
-					handle_price_deviations();
+					targets.push_back(Stage::price_deviations);
 				}
 
 				if (m_config.required_tagged_charts)
 				{
-					handle_tagged_charts();
+					targets.push_back(Stage::levels_output);
+					targets.push_back(Stage::tagged_charts);
 				}
 
 				if (m_config.required_environment)
 				{
-					handle_environment();
+					targets.push_back(Stage::levels_output);
+					targets.push_back(Stage::environment);
 				}
 
 				if (m_config.required_local_environment)
 				{
-					handle_local_environment();
-
-					if (m_config.run_local_environment_test)
-					{
-						run_local_environment_test();
-					}
-				}
-
-				if (m_config.required_quik)
-				{
-					handle_quik_initialization();
-				}
-
-				if (m_config.run_fridays_test)
-				{
-					run_fridays_test();
+					targets.push_back(Stage::local_environment);
 				}
 
-				if (m_config.run_mornings_test)
+				if (m_config.required_dataset)
 				{
-					run_mornings_test();
+					targets.push_back(Stage::dataset);
 				}
 
-				if (m_config.run_intraday_test)
+				if (m_config.required_quik)
 				{
-					run_intraday_test();
+					targets.push_back(Stage::sources);
 				}
-			}
-			catch (const std::exception & exception)
-			{
-				shared::catch_handler < market_exception > (logger, exception);
-			}
-		}
-
-		void Market::uninitialize()
-		{
-			RUN_LOGGER(logger);
 
-			try
-			{
-				m_thread_pool.join();
+				return targets;
 			}
 			catch (const std::exception & exception)
 			{
@@ -817,7 +1658,14 @@ namespace solution
 
 				if (!m_config.required_quik)
 				{
-					load_charts();
+					if (m_config.required_dataflow)
+					{
+						make_dataflow();
+					}
+					else
+					{
+						load_charts();
+					}
 				}
 			}
 			catch (const std::exception & exception)
@@ -922,9 +1770,7 @@ namespace solution
 					get_all_charts();
 				}
 
-				std::vector < std::future < void > > futures;
-
-				futures.reserve(std::size(m_assets) * std::size(m_scales));
+				Task_Group group(m_executor);
 
 				std::mutex mutex;
 
@@ -941,27 +1787,202 @@ namespace solution
 							continue;
 						}
 						
-						std::packaged_task < void() > task([this, path, &mutex, asset, scale, &logger]()
+						group.run([this, path, &mutex, asset, scale, &logger]()
 							{
 								auto candles = load_candles(asset, scale, path);
 
+								Calendar calendar(candles);
+
 								std::scoped_lock lock(mutex);
 
 								if (std::size(candles) > days_in_year)
 								{
 									m_charts[asset][scale] = std::move(candles);
+
+									m_calendars[asset][scale] = std::move(calendar);
 								}
 								else
 								{
 									logger.write(Severity::empty, "candles size exception: " + asset + " " + scale);
 								}
 							});
+					}
+				}
+
+				group.wait();
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::make_dataflow()
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				if (m_config.required_charts)
+				{
+					get_all_charts();
+				}
+
+				const auto required_tags = (m_config.required_tagged_charts || m_config.required_environment ||
+					m_config.required_local_environment || m_config.required_dataset);
+
+				const auto n_assets = std::size(m_assets);
+				const auto n_scales = std::size(m_scales);
+
+				std::vector < char > is_loaded(n_assets * n_scales, 0); // note: not std::vector < bool >, written concurrently
+
+				for (const auto & asset : m_assets)
+				{
+					for (const auto & scale : m_scales)
+					{
+						m_charts[asset][scale]; // note: all nodes are inserted before the tasks read them
+
+						m_calendars[asset][scale];
+					}
+
+					if (required_tags)
+					{
+						m_supports_resistances[asset];
+					}
+				}
+
+				const auto required_chart = [this, n_scales, &is_loaded](auto i, auto j)
+				{
+					if (!is_loaded[i * n_scales + j])
+					{
+						throw std::out_of_range("chart " + m_assets[i] + " " + m_scales[j] + " not loaded");
+					}
+				};
+
+				const auto resolution = static_cast < std::size_t > (std::distance(std::begin(m_scales),
+					std::find(std::begin(m_scales), std::end(m_scales), m_config.level_resolution)));
+
+				if (required_tags && resolution == n_scales)
+				{
+					throw std::invalid_argument("level resolution " + m_config.level_resolution + " not found");
+				}
+
+				Dataflow dataflow(m_executor);
+
+				Dataflow::nodes_container_t loads;
+
+				for (auto i = 0U; i < n_assets; ++i)
+				{
+					Dataflow::nodes_container_t asset_loads;
+
+					for (auto j = 0U; j < n_scales; ++j)
+					{
+						const auto & asset = m_assets[i];
+						const auto & scale = m_scales[j];
+
+						auto path = charts_directory; path /= make_file_name(asset, scale);
+
+						if (!std::filesystem::exists(path))
+						{
+							logger.write(Severity::error, "file " + path.string() + " doesn't exist");
+
+							asset_loads.push_back(dataflow.add([]() {}));
+
+							continue;
+						}
 
-						futures.push_back(boost::asio::post(m_thread_pool, std::move(task)));
+						asset_loads.push_back(dataflow.add([this, path, i, j, n_scales, &is_loaded, &logger]()
+							{
+								const auto & asset = m_assets[i];
+								const auto & scale = m_scales[j];
+
+								auto candles = load_candles(asset, scale, path);
+
+								if (std::size(candles) > days_in_year)
+								{
+									m_calendars.at(asset).at(scale) = Calendar(candles);
+
+									m_charts.at(asset).at(scale) = std::move(candles);
+
+									is_loaded[i * n_scales + j] = 1;
+								}
+								else
+								{
+									logger.write(Severity::empty, "candles size exception: " + asset + " " + scale);
+								}
+							}));
+					}
+
+					loads.insert(std::end(loads), std::begin(asset_loads), std::end(asset_loads));
+
+					if (required_tags)
+					{
+						auto levels = dataflow.add([this, i, resolution, &required_chart]()
+							{
+								required_chart(i, resolution);
+
+								m_supports_resistances.at(m_assets[i]) = make_levels(
+									m_charts.at(m_assets[i]).at(m_config.level_resolution));
+							}, { asset_loads[resolution] });
+
+						for (auto j = 0U; j < n_scales; ++j)
+						{
+							dataflow.add([this, i, j, &required_chart]()
+								{
+									required_chart(i, j);
+
+									update_tags(m_charts.at(m_assets[i]).at(m_scales[j]),
+										m_supports_resistances.at(m_assets[i]));
+								}, { asset_loads[j], levels });
+						}
 					}
 				}
 
-				std::for_each(std::begin(futures), std::end(futures), [](auto & future) { future.wait(); });
+				const auto required_charts = [n_assets, n_scales, &required_chart]()
+				{
+					for (auto i = 0U; i < n_assets; ++i)
+					{
+						for (auto j = 0U; j < n_scales; ++j)
+						{
+							required_chart(i, j);
+						}
+					}
+				};
+
+				if (m_config.required_self_similarities) // note: cross-asset stages wait only on loads
+				{
+					dataflow.add([this, &required_charts]() { required_charts(); handle_self_similarities(); }, loads);
+				}
+
+				if (m_config.required_pair_similarities)
+				{
+					dataflow.add([this, &required_charts]() { required_charts(); handle_pair_similarities(); }, loads);
+				}
+
+				if (m_config.required_pair_correlations)
+				{
+					dataflow.add([this, &required_charts]() { required_charts(); handle_pair_correlations(); }, loads);
+				}
+
+				dataflow.run();
+
+				for (auto i = 0U; i < n_assets; ++i)
+				{
+					auto & scales = m_charts.at(m_assets[i]);
+
+					for (auto j = 0U; j < n_scales; ++j)
+					{
+						if (!is_loaded[i * n_scales + j])
+						{
+							scales.erase(m_scales[j]);
+						}
+					}
+
+					if (scales.empty())
+					{
+						m_charts.erase(m_assets[i]);
+					}
+				}
 			}
 			catch (const std::exception & exception)
 			{
@@ -1062,40 +2083,43 @@ namespace solution
 
 				std::string line;
 
+				const auto limit = m_limits.find(asset);
+
 				while (std::getline(fin, line))
 				{
 					auto candle = parse(line);
 
-					if (m_limits.find(asset) == std::end(m_limits) || 
-						candle.raw_date >= m_limits.at(asset))
+					if (limit != std::end(m_limits) && candle.raw_date < limit->second)
 					{
-						if (candle.price_open < epsilon)
-						{
-							throw std::domain_error("required: (price_open > 0.0) for " + asset);
-						}
+						break; // note: newest candles first, the rest is older than limit
+					}
 
-						if (candle.price_high < epsilon)
-						{
-							throw std::domain_error("required: (price_high > 0.0) for " + asset);
-						}
+					if (candle.price_open < epsilon)
+					{
+						throw std::domain_error("required: (price_open > 0.0) for " + asset);
+					}
 
-						if (candle.price_low < epsilon)
-						{
-							throw std::domain_error("required: (price_low > 0.0) for " + asset);
-						}
+					if (candle.price_high < epsilon)
+					{
+						throw std::domain_error("required: (price_high > 0.0) for " + asset);
+					}
 
-						if (candle.price_close < epsilon)
-						{
-							throw std::domain_error("required: (price_close > 0.0) for " + asset);
-						}
+					if (candle.price_low < epsilon)
+					{
+						throw std::domain_error("required: (price_low > 0.0) for " + asset);
+					}
 
-						if (candle.volume == 0ULL)
-						{
-							throw std::domain_error("required: (volume > 0) for " + asset);
-						}
+					if (candle.price_close < epsilon)
+					{
+						throw std::domain_error("required: (price_close > 0.0) for " + asset);
+					}
 
-						candles.push_back(std::move(candle));
+					if (candle.volume == 0ULL)
+					{
+						throw std::domain_error("required: (volume > 0) for " + asset);
 					}
+
+					candles.push_back(std::move(candle));
 				}
 
 				std::reverse(std::begin(candles), std::end(candles));
@@ -1282,80 +2306,6 @@ namespace solution
 			}
 		}
 
-		void Market::handle_tagged_charts()
-		{
-			RUN_LOGGER(logger);
-
-			try
-			{
-				make_supports_resistances();
-
-				save_supports_resistances();
-
-				make_tagged_charts();
-
-				save_tagged_charts();
-			}
-			catch (const std::exception & exception)
-			{
-				shared::catch_handler < market_exception > (logger, exception);
-			}
-		}
-
-		void Market::handle_environment()
-		{
-			RUN_LOGGER(logger);
-
-			try
-			{
-				make_supports_resistances();
-
-				save_supports_resistances();
-
-				prepare_environment_data();
-
-				save_environment();
-			}
-			catch (const std::exception & exception)
-			{
-				shared::catch_handler < market_exception > (logger, exception);
-			}
-		}
-
-		void Market::handle_local_environment()
-		{
-			RUN_LOGGER(logger);
-
-			try
-			{
-				make_supports_resistances();
-
-				prepare_environment_data();
-
-				make_local_environment();
-			}
-			catch (const std::exception & exception)
-			{
-				shared::catch_handler < market_exception > (logger, exception);
-			}
-		}
-
-		void Market::handle_quik_initialization()
-		{
-			RUN_LOGGER(logger);
-
-			try
-			{
-				initialize_sources();
-
-				update_supports_resistances();
-			}
-			catch (const std::exception & exception)
-			{
-				shared::catch_handler < market_exception > (logger, exception);
-			}
-		}
-
 		void Market::run_local_environment_test() const
 		{
 			RUN_LOGGER(logger);
@@ -1479,63 +2429,41 @@ namespace solution
 			/*
 			try
 			{
-				std::mutex mutex;
-
 				auto reward = 0.0;
 
 				auto total_counter = 0U;
 				auto error_counter = 0U;
 
-				for (const auto & record_test : m_environment_test)
-				{
-					std::vector < std::pair < double, Record > > neighbours;
-
-					neighbours.reserve(m_config.knn_method_parameter);
-
-					std::for_each(std::execution::par, std::begin(m_environment), std::end(m_environment),
-						[this, &mutex, &record_test, &neighbours](const auto & record)
-						{
-							if (std::abs(duration(record_test.date_time, record.date_time)) /
-									seconds_in_day >= m_config.knn_method_timesteps)
-							{
-								auto current_distance = distance(record_test, record);
+				const auto environment      = m_environment.train();
+				const auto environment_test = m_environment.test();
 
-								std::scoped_lock lock(mutex);
+				const KNN_Engine engine(m_executor, environment, { m_config.knn_method_parameter,
+					static_cast < std::time_t > (m_config.knn_method_timesteps) * seconds_in_day });
 
-								if (std::size(neighbours) < m_config.knn_method_parameter)
-								{
-									neighbours.push_back(std::make_pair(current_distance, record));
-								}
-								else if (neighbours.back().first > current_distance)
-								{
-									neighbours.back().first  = current_distance;
-									neighbours.back().second = record;
-								}
+				const auto results = engine.find(environment_test);
+
+				for (auto index = 0U; index < std::size(environment_test); ++index)
+				{
+					const auto & neighbours = results[index];
 
-								std::sort(std::begin(neighbours), std::end(neighbours),
-									[](const auto & lhs, const auto & rhs)
-										{ return (lhs.first < rhs.first); });
-							}
-						});
-										
 					auto direction = 0;
 
 					for (const auto & neighbour : neighbours)
 					{
-						direction += neighbour.second.direction;
+						direction += environment.direction(neighbour.index);
 					}
 
 					direction = ((direction == 0) ? 1 : (direction / std::abs(direction)));
 
-					//reward += direction * record_test.deviation * m_config.transaction_base_value;
+					//reward += direction * environment_test.deviation(index) * m_config.transaction_base_value;
 
 					++total_counter;
 
-					std::cout << record_test.asset << " [" << record_test.date_time << "] DIRECTION: " 
+					std::cout << m_environment.asset(environment_test.asset(index)) << " [" << environment_test.timestamp(index) << "] DIRECTION: " 
 						<< std::showpos << direction << " REWARD: " <<
 						std::setw(8) << std::setfill(' ') << std::right <<
 						std::setprecision(2) << std::fixed << std::showpos << reward <<
-							((direction * record_test.deviation < 0.0) ? " ERROR (" + 
+							((direction * environment_test.deviation(index) < 0.0) ? " ERROR (" + 
 								std::to_string(static_cast < int > (100.0 * 
 									(++error_counter) / total_counter)) + "%)\n" : "\n");
 				}
@@ -1609,6 +2537,146 @@ namespace solution
 			*/
 		}
 
+		void Market::run_knn_benchmark() const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				using clock_t = std::chrono::steady_clock;
+
+				const auto environment      = m_environment.train();
+				const auto environment_test = m_environment.test();
+
+				if (std::empty(environment) || std::empty(environment_test))
+				{
+					throw market_exception("empty local environment");
+				}
+
+				const auto k = m_config.knn_method_parameter;
+
+				const auto exclusion = m_config.knn_method_timesteps * seconds_in_day;
+
+				auto microseconds = [&environment_test](auto begin) // note: per query, queries run in parallel
+				{
+					return std::chrono::duration < double, std::micro > (clock_t::now() - begin).count() / std::size(environment_test);
+				};
+
+				auto begin = clock_t::now();
+
+				const auto exact = KNN_Engine(m_executor, environment, { k, exclusion }).find(environment_test);
+
+				const auto exact_latency = microseconds(begin);
+
+				auto recall = [&exact](const auto & results)
+				{
+					std::size_t n_hits = 0U;
+					std::size_t n_true = 0U;
+
+					for (auto i = 0U; i < std::size(exact); ++i)
+					{
+						n_true += std::size(exact[i]);
+
+						for (const auto & neighbour : results[i])
+						{
+							n_hits += std::count_if(std::begin(exact[i]), std::end(exact[i]),
+								[&neighbour](const auto & exact_neighbour) { return (exact_neighbour.index == neighbour.index); });
+						}
+					}
+
+					return (n_true ? 1.0 * n_hits / n_true : 1.0);
+				};
+
+				auto error = [&environment, &environment_test](const auto & results) // note: share of wrong directions by vote
+				{
+					std::size_t n_errors = 0U;
+
+					for (auto i = 0U; i < std::size(environment_test); ++i)
+					{
+						auto direction = 0;
+
+						for (const auto & neighbour : results[i])
+						{
+							direction += environment.direction(neighbour.index);
+						}
+
+						direction = ((direction == 0) ? 1 : (direction / std::abs(direction)));
+
+						n_errors += (direction * environment_test.deviation(i) < 0.0F);
+					}
+
+					return 1.0 * n_errors / std::size(environment_test);
+				};
+
+				std::cout << "exact : error " << std::setprecision(4) << std::fixed << std::noshowpos << error(exact) << " at " <<
+					std::setw(8) << std::setprecision(1) << std::fixed << exact_latency << " us/query" << std::endl;
+
+				for (const auto rerank : { std::size_t(0U), m_config.knn_rerank_size })
+				{
+					KNN_Engine::Parameters parameters { k, exclusion };
+
+					parameters.is_quantized = true;
+
+					parameters.rerank = rerank;
+
+					begin = clock_t::now();
+
+					const auto results = KNN_Engine(m_executor, environment, parameters).find(environment_test);
+
+					const auto latency = microseconds(begin);
+
+					std::cout <<
+						"int8, rerank = " << std::setw(5) << std::setfill(' ') << std::right << rerank << " : recall " <<
+						std::setw(6) << std::setprecision(4) << std::fixed << recall(results) << ", error " <<
+						std::setw(6) << std::setprecision(4) << std::fixed << error(results) << " at " <<
+						std::setw(8) << std::setprecision(1) << std::fixed << latency << " us/query" << std::endl;
+
+					if (m_config.knn_rerank_size == 0U)
+					{
+						break;
+					}
+				}
+
+				begin = clock_t::now();
+
+				HNSW_Index builder(m_executor, environment.n_features(), {
+					m_config.hnsw_max_connections, m_config.hnsw_ef_construction });
+
+				builder.insert(environment);
+
+				const auto build_time = std::chrono::duration < double > (clock_t::now() - begin).count();
+
+				Data::save_environment_index(builder);
+
+				HNSW_Index index(m_executor, environment.n_features(), {});
+
+				Data::load_environment_index(index); // note: searches run on the persisted index
+
+				std::cout << "HNSW " << std::size(index) << " records built in " <<
+					std::setprecision(1) << std::fixed << build_time << " s" << std::endl;
+
+				for (auto ef = k; ef <= std::max(k, m_config.hnsw_max_ef_search); ef *= 2U)
+				{
+					begin = clock_t::now();
+
+					const auto results = index.find(environment_test, k, ef, exclusion);
+
+					const auto latency = microseconds(begin);
+
+					std::cout <<
+						"HNSW, ef = " << std::setw(5) << std::setfill(' ') << std::right << ef << " : recall " <<
+						std::setw(6) << std::setprecision(4) << std::fixed << recall(results) << ", error " <<
+						std::setw(6) << std::setprecision(4) << std::fixed << error(results) << " at " <<
+						std::setw(8) << std::setprecision(1) << std::fixed << latency << " us/query (x" <<
+						std::setprecision(1) << std::fixed << exact_latency / std::max(latency, 1e-9) << ")" << std::endl;
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
 		void Market::run_fridays_test() const
 		{
 			RUN_LOGGER(logger);
@@ -1621,13 +2689,15 @@ namespace solution
 				{
 					const auto & candles = m_charts.at(asset).at(scale);
 
+					const auto & calendar = m_calendars.at(asset).at(scale);
+
 					std::size_t counter = 0U;
 
 					std::size_t counter_total = 0U;
 
 					for (auto i = 0U; i < std::size(candles) - 1U; ++i)
 					{
-						if (day_of_week(candles[i]) == 3U && day_of_week(candles[i + 1]) == 4U)
+						if (calendar.weekday(i) == 3U && calendar.weekday(i + 1U) == 4U)
 						{
 							if (candles[i].price_deviation * candles[i + 1U].price_deviation > 0.0)
 							{
@@ -1665,47 +2735,38 @@ namespace solution
 					logger.write(Severity::error, "invalid scale");
 				}
 
-				const auto & candles = m_charts.at(asset).at(scale);
-
-				std::size_t counter            = 0U;
-				std::size_t counter_delta_L    = 0U;
-				std::size_t counter_delta_S    = 0U;
-				std::size_t counter_delta_both = 0U;
-
-				for (auto i = 1U; i < std::size(candles) - 1U; ++i)
-				{
-					if (candles[i].date_time.year != m_config.mornings_test_year || candles[i].date_time.hour != 10U)
-					{
-						continue;
-					}
+				Event_Study event_study(m_executor);
 
-					++counter;
+				event_study.insert(asset, scale, m_charts.at(asset).at(scale), m_calendars.at(asset).at(scale));
 
-					auto previous_price = candles[i - 1U].price_close;
+				const Event_Study::Query query { scale, Event_Study::parse("hour == 10 && year == " +
+					std::to_string(m_config.mornings_test_year)), { 2U, delta, false } };
 
-					auto has_delta_L = (std::max(candles[i].price_high, candles[i + 1U].price_high) - previous_price >  delta);
-					auto has_delta_S = (std::min(candles[i].price_low,  candles[i + 1U].price_low ) - previous_price < -delta);
+				Event_Study::Statistics statistics;
 
-					if (has_delta_L)
-					{
-						++counter_delta_L;
-					}
+				for (const auto & result : event_study.run(query))
+				{
+					statistics = result.statistics;
+				}
 
-					if (has_delta_S)
-					{
-						++counter_delta_S;
-					}
+				std::cout << "days        : " << statistics.n_events << std::endl;
+				std::cout << "days (L)    : " << statistics.n_L      << std::endl;
+				std::cout << "days (S)    : " << statistics.n_S      << std::endl;
+				std::cout << "days (both) : " << statistics.n_both   << std::endl;
 
-					if (has_delta_L && has_delta_S)
+				if (m_config.significance_resamples > 0U)
+				{
+					for (const auto & [name, measure] : { std::make_pair("L", Event_Study::Measure::L), std::make_pair("S", Event_Study::Measure::S) })
 					{
-						++counter_delta_both;
+						for (const auto & significance : test_significance(event_study.samples(query, measure), m_config.mornings_test_confidence))
+						{
+							std::cout << "share (" << name << ")   : " <<
+								std::setprecision(3) << std::fixed << std::noshowpos << significance.mean << " [" << significance.lower << ", " <<
+								significance.upper << "] vs " << significance.mean_population << ", p = " <<
+								std::setprecision(4) << significance.p_value << std::endl;
+						}
 					}
 				}
-
-				std::cout << "days        : " << counter            << std::endl;
-				std::cout << "days (L)    : " << counter_delta_L    << std::endl;
-				std::cout << "days (S)    : " << counter_delta_S    << std::endl;
-				std::cout << "days (both) : " << counter_delta_both << std::endl;
 			}
 			catch (const std::exception & exception)
 			{
@@ -1727,49 +2788,91 @@ namespace solution
 					logger.write(Severity::error, "invalid scale");
 				}
 
-				const auto & candles = m_charts.at(asset).at(scale);
-
 				const auto deviation = m_config.intraday_test_deviation;
 
-				std::size_t counter                = 0U;
-				std::size_t counter_deviation_L    = 0U;
-				std::size_t counter_deviation_S    = 0U;
-				std::size_t counter_deviation_both = 0U;
+				Event_Study event_study(m_executor);
+
+				event_study.insert(asset, scale, m_charts.at(asset).at(scale), m_calendars.at(asset).at(scale));
+
+				const Event_Study::Query query { scale, Event_Study::parse("year == " +
+					std::to_string(m_config.intraday_test_year)), { 1U, deviation, true } };
 
-				for (auto i = 1U; i < std::size(candles); ++i)
+				Event_Study::Statistics statistics;
+
+				for (const auto & result : event_study.run(query))
 				{
-					if (candles[i].date_time.year != m_config.intraday_test_year)
-					{
-						continue;
-					}
+					statistics = result.statistics;
+				}
 
-					++counter;
+				std::cout << "days        : " << statistics.n_events << std::endl;
+				std::cout << "days (L)    : " << statistics.n_L      << std::endl;
+				std::cout << "days (S)    : " << statistics.n_S      << std::endl;
+				std::cout << "days (both) : " << statistics.n_both   << std::endl;
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
 
-					auto previous_price = candles[i - 1U].price_close;
+		void Market::run_event_study() const
+		{
+			RUN_LOGGER(logger);
 
-					auto has_deviation_L = ((candles[i].price_high - previous_price) / previous_price >  deviation);
-					auto has_deviation_S = ((candles[i].price_low  - previous_price) / previous_price < -deviation);
+			try
+			{
+				Event_Study event_study(m_executor);
 
-					if (has_deviation_L)
+				for (const auto & [asset, chart] : m_charts)
+				{
+					if (const auto iterator = chart.find(m_config.event_study_scale); iterator != std::end(chart))
 					{
-						++counter_deviation_L;
+						event_study.insert(asset, iterator->first, iterator->second, m_calendars.at(asset).at(iterator->first));
 					}
+				}
 
-					if (has_deviation_S)
-					{
-						++counter_deviation_S;
-					}
+				const Event_Study::Query query { m_config.event_study_scale, Event_Study::parse(m_config.event_study_conditions),
+					{ m_config.event_study_horizon, m_config.event_study_threshold, m_config.event_study_is_relative } };
+
+				std::cout << "events : " << m_config.event_study_conditions << std::endl;
+
+				for (const auto & [asset, year, statistics] : event_study.run(query))
+				{
+					const auto n = std::max(statistics.n_events, std::size_t(1U));
+
+					std::cout <<
+						std::setw(5) << std::setfill(' ') << std::left  << asset << " " << year << " : " <<
+						std::setw(5) << std::setfill(' ') << std::right << statistics.n_events << " events, L " <<
+						std::setw(6) << std::setprecision(3) << std::fixed << std::noshowpos << 1.0 * statistics.n_L    / n << ", S " <<
+						std::setw(6) << std::setprecision(3) << std::fixed << std::noshowpos << 1.0 * statistics.n_S    / n << ", both " <<
+						std::setw(6) << std::setprecision(3) << std::fixed << std::noshowpos << 1.0 * statistics.n_both / n << ", up " <<
+						std::setw(6) << std::setprecision(3) << std::fixed << std::noshowpos << 1.0 * statistics.n_positive / n << ", mean " <<
+						std::setw(9) << std::setprecision(5) << std::fixed << std::showpos   << statistics.mean << ", sd " <<
+						std::setw(8) << std::setprecision(5) << std::fixed << std::noshowpos << statistics.sd << std::endl;
+				}
+
+				if (m_config.significance_resamples > 0U)
+				{
+					const auto samples = event_study.samples(query, Event_Study::Measure::close_return);
+
+					const auto significances = test_significance(samples, m_config.event_study_confidence);
 
-					if (has_deviation_L && has_deviation_S)
+					std::cout << "significance of mean return, " << m_config.significance_resamples << " resamples" << std::endl;
+
+					for (auto i = 0U; i < std::size(samples); ++i)
 					{
-						++counter_deviation_both;
+						const auto & significance = significances[i];
+
+						std::cout <<
+							std::setw(5) << std::setfill(' ') << std::left  << samples[i].asset << " : " <<
+							std::setw(5) << std::setfill(' ') << std::right << significance.n_events << " events, mean " <<
+							std::setw(9) << std::setprecision(5) << std::fixed << std::showpos << significance.mean << " [" <<
+							std::setw(9) << std::setprecision(5) << std::fixed << std::showpos << significance.lower << ", " <<
+							std::setw(9) << std::setprecision(5) << std::fixed << std::showpos << significance.upper << "] vs " <<
+							std::setw(9) << std::setprecision(5) << std::fixed << std::showpos << significance.mean_population << ", p = " <<
+							std::setprecision(4) << std::fixed << std::noshowpos << significance.p_value << std::endl;
 					}
 				}
-
-				std::cout << "days        : " << counter                << std::endl;
-				std::cout << "days (L)    : " << counter_deviation_L    << std::endl;
-				std::cout << "days (S)    : " << counter_deviation_S    << std::endl;
-				std::cout << "days (both) : " << counter_deviation_both << std::endl;
 			}
 			catch (const std::exception & exception)
 			{
@@ -1777,24 +2880,24 @@ namespace solution
 			}
 		}
 
-		double Market::distance(const Record & record_test, const Record & record) const
+		Market::Resampler::significances_container_t Market::test_significance(
+			const Event_Study::samples_container_t & samples, double confidence) const
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				const auto epsilon = std::numeric_limits < double > ::epsilon();
+				Resampler::samples_container_t resampler_samples;
 
-				auto distance = 0.0;
+				resampler_samples.reserve(std::size(samples));
 
-				for (auto j = 0U; j < std::size(record_test.vector); ++j)
+				for (const auto & sample : samples)
 				{
-					distance += 
-						std::min(std::abs(record_test.vector[j] - record.vector[j]) /
-						std::max(std::abs(record_test.vector[j]), epsilon), 1.0);
+					resampler_samples.push_back(Resampler::Sample { sample.events, sample.population });
 				}
 
-				return distance;
+				return Resampler(m_executor, { m_config.significance_resamples, confidence,
+					m_config.significance_seed }).run(resampler_samples);
 			}
 			catch (const std::exception & exception)
 			{
@@ -1810,51 +2913,55 @@ namespace solution
 			{
 				const auto size = std::size(m_scales);
 
-				std::vector < std::future < double > > futures;
+				std::vector < self_similarity_matrix_t * > matrices;
 
-				futures.reserve(std::size(m_assets) * size * (size - 1U) / 2U);
+				matrices.reserve(std::size(m_assets));
 
 				for (const auto & asset : m_assets)
 				{
+					auto & matrix = m_self_similarities.insert(std::make_pair(asset,
+						self_similarity_matrix_t(boost::extents[size][size]))).first->second;
+
 					for (auto i = 0U; i < size; ++i)
 					{
-						for (auto j = i + 1; j < size; ++j)
-						{
-							std::packaged_task < double() > task([this, asset, i, j]()
-								{ return compute_self_similarity(asset, m_scales[i], m_scales[j]); });
-
-							futures.push_back(boost::asio::post(m_thread_pool, std::move(task)));
-						}
+						matrix[i][i] = 0.0;
 					}
+
+					matrices.push_back(&matrix);
 				}
 
-				auto index = 0U;
+				Data::Cache cache;
 
-				for (const auto & asset : m_assets)
+				if (m_config.required_matrices_cache)
 				{
-					m_self_similarities.insert(std::make_pair(asset, self_similarity_matrix_t(boost::extents[size][size])));
+					Data::load_self_similarities_cache(cache);
+				}
 
-					for (auto i = 0U; i < size; ++i)
+				Tracker tracker(cache.fingerprints);
+
+				track_charts(tracker, Tracker::hash(&m_config.self_similarity_DTW_delta, sizeof(m_config.self_similarity_DTW_delta)));
+
+				auto masks = restore_matrices(cache, tracker, m_assets, m_scales, matrices,
+					[this](auto index, auto i) { return (m_assets[index] + " " + m_scales[i]); });
+
+				const auto asset = std::find(std::begin(m_assets), std::end(m_assets), m_config.cumulative_distances_asset);
+				const auto scale = std::find(std::begin(m_scales), std::end(m_scales), m_config.cumulative_distances_scale_1);
+
+				if (asset != std::end(m_assets) && scale != std::end(m_scales))
+				{
+					masks[std::distance(std::begin(m_assets), asset)][std::distance(std::begin(m_scales), scale)] = true; // note: rewrites cumulative distances
+				}
+
+				Scheduler().run(m_executor, std::size(matrices), size, [this, &matrices](auto index, auto i, auto j)
 					{
-						for (auto j = 0U; j < size; ++j)
-						{
-							if (i == j)
-							{
-								m_self_similarities[asset][i][j] = 0.0;
-							}
-							else
-							{
-								if (i > j)
-								{
-									m_self_similarities[asset][i][j] = m_self_similarities[asset][j][i];
-								}
-								else
-								{
-									m_self_similarities[asset][i][j] = futures[index++].get();
-								}
-							}
-						}
-					}
+						auto & matrix = *matrices[index];
+
+						matrix[i][j] = matrix[j][i] = compute_self_similarity(m_assets[index], m_scales[i], m_scales[j]);
+					}, masks);
+
+				if (m_config.required_matrices_cache)
+				{
+					Data::save_self_similarities_cache(m_self_similarities, m_scales, tracker.fingerprints());
 				}
 			}
 			catch (const std::exception & exception)
@@ -1871,51 +2978,104 @@ namespace solution
 			{
 				const auto size = std::size(m_assets);
 
-				std::vector < std::future < double > > futures;
+				std::vector < pair_similarity_matrix_t * > matrices;
 
-				futures.reserve(std::size(m_scales) * size * (size - 1U) / 2U);
+				matrices.reserve(std::size(m_scales));
 
 				for (const auto & scale : m_scales)
 				{
+					auto & matrix = m_pair_similarities.insert(std::make_pair(scale,
+						pair_similarity_matrix_t(boost::extents[size][size]))).first->second;
+
 					for (auto i = 0U; i < size; ++i)
 					{
-						for (auto j = i + 1; j < size; ++j)
-						{
-							std::packaged_task < double() > task([this, scale, i, j]()
-								{ return compute_pair_similarity(scale, m_assets[i], m_assets[j]); });
-
-							futures.push_back(boost::asio::post(m_thread_pool, std::move(task)));
-						}
+						matrix[i][i] = 0.0;
 					}
+
+					matrices.push_back(&matrix);
+				}
+
+				Data::Cache cache;
+
+				if (m_config.required_matrices_cache)
+				{
+					Data::load_pair_similarities_cache(cache);
+				}
+
+				Tracker tracker(cache.fingerprints);
+
+				track_charts(tracker, Tracker::fingerprint_t());
+
+				auto masks = restore_matrices(cache, tracker, m_scales, m_assets, matrices,
+					[this](auto index, auto i) { return (m_assets[i] + " " + m_scales[index]); });
+
+				Scheduler().run(m_executor, std::size(matrices), size, [this, &matrices](auto index, auto i, auto j)
+					{
+						auto & matrix = *matrices[index];
+
+						matrix[i][j] = matrix[j][i] = compute_pair_similarity(m_scales[index], m_assets[i], m_assets[j]);
+					}, masks);
+
+				if (m_config.required_matrices_cache)
+				{
+					Data::save_pair_similarities_cache(m_pair_similarities, m_assets, tracker.fingerprints());
 				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::compute_pair_correlations()
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				const auto size = std::size(m_assets);
+
+				std::vector < pair_correlation_matrix_t * > matrices;
 
-				auto index = 0U;
+				matrices.reserve(std::size(m_scales));
 
 				for (const auto & scale : m_scales)
 				{
-					m_pair_similarities.insert(std::make_pair(scale, pair_similarity_matrix_t(boost::extents[size][size])));
+					auto & matrix = m_pair_correlations.insert(std::make_pair(scale,
+						pair_correlation_matrix_t(boost::extents[size][size]))).first->second;
 
 					for (auto i = 0U; i < size; ++i)
 					{
-						for (auto j = 0U; j < size; ++j)
-						{
-							if (i == j)
-							{
-								m_pair_similarities[scale][i][j] = 0.0;
-							}
-							else
-							{
-								if (i > j)
-								{
-									m_pair_similarities[scale][i][j] = m_pair_similarities[scale][j][i];
-								}
-								else
-								{
-									m_pair_similarities[scale][i][j] = futures[index++].get();
-								}
-							}
-						}
+						matrix[i][i] = 1.0;
 					}
+
+					matrices.push_back(&matrix);
+				}
+
+				Data::Cache cache;
+
+				if (m_config.required_matrices_cache)
+				{
+					Data::load_pair_correlations_cache(cache);
+				}
+
+				Tracker tracker(cache.fingerprints);
+
+				track_charts(tracker, Tracker::fingerprint_t());
+
+				auto masks = restore_matrices(cache, tracker, m_scales, m_assets, matrices,
+					[this](auto index, auto i) { return (m_assets[i] + " " + m_scales[index]); });
+
+				Scheduler().run(m_executor, std::size(matrices), size, [this, &matrices](auto index, auto i, auto j)
+					{
+						auto & matrix = *matrices[index];
+
+						matrix[i][j] = matrix[j][i] = compute_pair_correlation(m_scales[index], m_assets[i], m_assets[j]);
+					}, masks);
+
+				if (m_config.required_matrices_cache)
+				{
+					Data::save_pair_correlations_cache(m_pair_correlations, m_assets, tracker.fingerprints());
 				}
 			}
 			catch (const std::exception & exception)
@@ -1924,60 +3084,101 @@ namespace solution
 			}
 		}
 
-		void Market::compute_pair_correlations()
+		void Market::track_charts(Tracker & tracker, Tracker::fingerprint_t context) const
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				const auto size = std::size(m_assets);
+				tracker.update(Tracker::context_key, context);
+
+				for (const auto & asset : m_assets)
+				{
+					for (const auto & scale : m_scales)
+					{
+						tracker.update(asset + " " + scale, m_charts.at(asset).at(scale));
+					}
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		template < typename Key >
+		Market::Scheduler::masks_container_t Market::restore_matrices(const Data::Cache & cache, const Tracker & tracker,
+			const Data::labels_container_t & labels, const Data::labels_container_t & axis_labels,
+			const std::vector < Data::matrix_t * > & matrices, Key key) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				const auto size = std::size(axis_labels);
+
+				Scheduler::masks_container_t masks(std::size(matrices), Scheduler::mask_t(size, true));
+
+				if (tracker.is_changed(Tracker::context_key))
+				{
+					return masks;
+				}
+
+				std::unordered_map < std::string, std::size_t > cached_labels;
+				std::unordered_map < std::string, std::size_t > cached_axis_labels;
+
+				for (auto i = 0U; i < std::size(cache.labels); ++i)
+				{
+					cached_labels[cache.labels[i]] = i;
+				}
+
+				for (auto i = 0U; i < std::size(cache.axis_labels); ++i)
+				{
+					cached_axis_labels[cache.axis_labels[i]] = i;
+				}
+
+				std::vector < std::size_t > positions(size);
+
+				for (auto index = 0U; index < std::size(matrices); ++index)
+				{
+					auto cached_label = cached_labels.find(labels[index]);
+
+					if (cached_label == std::end(cached_labels))
+					{
+						continue;
+					}
 
-				std::vector < std::future < double > > futures;
+					const auto & cached_matrix = cache.matrices[cached_label->second];
 
-				futures.reserve(std::size(m_scales) * size * (size - 1U) / 2U);
+					auto & mask = masks[index];
 
-				for (const auto & scale : m_scales)
-				{
 					for (auto i = 0U; i < size; ++i)
 					{
-						for (auto j = i + 1; j < size; ++j)
+						auto cached_axis_label = cached_axis_labels.find(axis_labels[i]);
+
+						if (cached_axis_label != std::end(cached_axis_labels) && !tracker.is_changed(key(index, i)))
 						{
-							std::packaged_task < double() > task([this, scale, i, j]()
-								{ return compute_pair_correlation(scale, m_assets[i], m_assets[j]); });
+							positions[i] = cached_axis_label->second;
 
-							futures.push_back(boost::asio::post(m_thread_pool, std::move(task)));
+							mask[i] = false;
 						}
 					}
-				}
 
-				auto index = 0U;
-
-				for (const auto & scale : m_scales)
-				{
-					m_pair_correlations.insert(std::make_pair(scale, pair_correlation_matrix_t(boost::extents[size][size])));
+					auto & matrix = *matrices[index];
 
 					for (auto i = 0U; i < size; ++i)
 					{
-						for (auto j = 0U; j < size; ++j)
+						for (auto j = i + 1U; j < size; ++j)
 						{
-							if (i == j)
-							{
-								m_pair_correlations[scale][i][j] = 1.0;
-							}
-							else
+							if (!mask[i] && !mask[j])
 							{
-								if (i > j)
-								{
-									m_pair_correlations[scale][i][j] = m_pair_correlations[scale][j][i];
-								}
-								else
-								{
-									m_pair_correlations[scale][i][j] = futures[index++].get();
-								}
+								matrix[i][j] = matrix[j][i] = cached_matrix[positions[i]][positions[j]];
 							}
 						}
 					}
 				}
+
+				return masks;
 			}
 			catch (const std::exception & exception)
 			{
@@ -2042,7 +3243,7 @@ namespace solution
 					(scale_1 == m_config.cumulative_distances_scale_1 && scale_2 == m_config.cumulative_distances_scale_2) ||
 					(scale_2 == m_config.cumulative_distances_scale_1 && scale_1 == m_config.cumulative_distances_scale_2)))
 				{
-					save_cumulative_distances(cumulative_distances);
+					save_cumulative_distances(cumulative_distances, asset, scale_1, scale_2);
 				}
 
 				return cumulative_distances[size_1 - 1][size_2 - 1] / std::max(size_1, size_2);
@@ -2060,18 +3261,18 @@ namespace solution
 
 			try
 			{
-				const auto & candles_1 = m_charts.at(asset_1).at(scale);
-				const auto & candles_2 = m_charts.at(asset_2).at(scale);
+				auto size = std::min(std::size(m_charts.at(asset_1).at(scale)), std::size(m_charts.at(asset_2).at(scale)));
 
-				auto size = std::min(std::size(candles_1), std::size(candles_2));
+				const auto candles_1 = get_last_candles(asset_1, scale, size);
+				const auto candles_2 = get_last_candles(asset_2, scale, size);
 
 				std::vector < double > price_deviations_1(size, 0.0);
 				std::vector < double > price_deviations_2(size, 0.0);
 
-				std::transform(std::crbegin(candles_1), std::next(std::crbegin(candles_1), size),
+				std::transform(std::make_reverse_iterator(std::end(candles_1)), std::make_reverse_iterator(std::begin(candles_1)),
 					std::begin(price_deviations_1), [](const auto & candle) { return candle.price_deviation; });
 
-				std::transform(std::crbegin(candles_2), std::next(std::crbegin(candles_2), size),
+				std::transform(std::make_reverse_iterator(std::end(candles_2)), std::make_reverse_iterator(std::begin(candles_2)),
 					std::begin(price_deviations_2), [](const auto & candle) { return candle.price_deviation; });
 
 				std::sort(std::begin(price_deviations_1), std::end(price_deviations_1));
@@ -2093,22 +3294,22 @@ namespace solution
 
 			try
 			{
-				const auto & candles_1 = m_charts.at(asset_1).at(scale);
-				const auto & candles_2 = m_charts.at(asset_2).at(scale);
+				auto size = std::min(std::size(m_charts.at(asset_1).at(scale)), std::size(m_charts.at(asset_2).at(scale)));
 
-				auto size = std::min(std::size(candles_1), std::size(candles_2));
+				const auto candles_1 = get_last_candles(asset_1, scale, size);
+				const auto candles_2 = get_last_candles(asset_2, scale, size);
 
 				std::vector < std::pair < double, int > > price_deviations_1(size);
 				std::vector < std::pair < double, int > > price_deviations_2(size);
 
 				auto index = 1;
 
-				std::transform(std::crbegin(candles_1), std::next(std::crbegin(candles_1), size),
+				std::transform(std::make_reverse_iterator(std::end(candles_1)), std::make_reverse_iterator(std::begin(candles_1)),
 					std::begin(price_deviations_1), [&index](const auto & candle) { return std::make_pair(candle.price_deviation, index++); });
 
 				index = 1;
 
-				std::transform(std::crbegin(candles_2), std::next(std::crbegin(candles_2), size),
+				std::transform(std::make_reverse_iterator(std::end(candles_2)), std::make_reverse_iterator(std::begin(candles_2)),
 					std::begin(price_deviations_2), [&index](const auto & candle) { return std::make_pair(candle.price_deviation, index++); });
 
 				std::sort(std::begin(price_deviations_1), std::end(price_deviations_1),
@@ -2131,7 +3332,12 @@ namespace solution
 
 			try
 			{
-				Data::save_self_similarities(m_self_similarities);
+				Data::save_self_similarities_binary(m_self_similarities, m_scales, m_config.required_float32_matrices);
+
+				if (m_config.required_text_matrices)
+				{
+					Data::save_self_similarities(m_self_similarities);
+				}
 			}
 			catch (const std::exception & exception)
 			{
@@ -2145,7 +3351,12 @@ namespace solution
 
 			try
 			{
-				Data::save_pair_similarities(m_pair_similarities);
+				Data::save_pair_similarities_binary(m_pair_similarities, m_assets, m_config.required_float32_matrices);
+
+				if (m_config.required_text_matrices)
+				{
+					Data::save_pair_similarities(m_pair_similarities);
+				}
 			}
 			catch (const std::exception & exception)
 			{
@@ -2159,7 +3370,12 @@ namespace solution
 
 			try
 			{
-				Data::save_pair_correlations(m_pair_correlations);
+				Data::save_pair_correlations_binary(m_pair_correlations, m_assets, m_config.required_float32_matrices);
+
+				if (m_config.required_text_matrices)
+				{
+					Data::save_pair_correlations(m_pair_correlations);
+				}
 			}
 			catch (const std::exception & exception)
 			{
@@ -2167,13 +3383,20 @@ namespace solution
 			}
 		}
 
-		void Market::save_cumulative_distances(const distances_matrix_t & matrix) const
+		void Market::save_cumulative_distances(const distances_matrix_t & matrix, const std::string & asset,
+			const std::string & scale_1, const std::string & scale_2) const
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				Data::save_cumulative_distances(matrix);
+				Data::save_cumulative_distances_binary(matrix, asset + " " + scale_1 + " " + scale_2,
+					m_config.required_float32_matrices);
+
+				if (m_config.required_text_matrices)
+				{
+					Data::save_cumulative_distances(matrix);
+				}
 			}
 			catch (const std::exception & exception)
 			{
@@ -2187,7 +3410,7 @@ namespace solution
 
 			try
 			{
-				Data::save_price_deviations(m_charts);
+				Data::save_price_deviations(m_charts, m_executor);
 			}
 			catch (const std::exception & exception)
 			{
@@ -2201,15 +3424,13 @@ namespace solution
 
 			try
 			{
-				std::vector < std::future < void > > futures;
-
-				futures.reserve(std::size(m_assets));
+				Task_Group group(m_executor);
 
 				std::mutex mutex;
 
 				for (const auto & asset : m_assets)
 				{
-					std::packaged_task < void() > task([this, asset, &mutex]()
+					group.run([this, asset, &mutex]()
 						{
 							auto levels = make_levels(m_charts.at(asset).at(m_config.level_resolution));
 
@@ -2217,11 +3438,9 @@ namespace solution
 
 							m_supports_resistances[asset] = std::move(levels);
 						});
-
-					futures.push_back(boost::asio::post(m_thread_pool, std::move(task)));
 				}
 
-				std::for_each(std::begin(futures), std::end(futures), [](auto & future) { future.wait(); });
+				group.wait();
 			}
 			catch (const std::exception & exception)
 			{
@@ -2237,36 +3456,36 @@ namespace solution
 			{
 				levels_container_t levels;
 
-				for (auto bias = m_config.level_min_bias; bias <= m_config.level_max_bias; ++bias)
-				{
-					for (auto first = std::begin(candles); first != 
-							std::prev(std::end(candles), 2U * bias); ++first)
-					{
-						auto [min_candle, max_candle] = std::minmax_element(
-							first, std::next(first, 2U * bias + 1U),
-							[](const auto & lhs, const auto & rhs)
-							{
-								return (
-									(lhs.price_high + lhs.price_low + lhs.price_close) <
-									(rhs.price_high + rhs.price_low + rhs.price_close));
-							});
+				Detector::values_container_t prices(std::size(candles));
 
-						if (std::distance(first, min_candle) == bias)
-						{
-							make_level(*min_candle, levels, bias, Candle::Type::local_min);
-						}
+				std::transform(std::begin(candles), std::end(candles), std::begin(prices), [](const auto & candle)
+					{ return (candle.price_high + candle.price_low + candle.price_close); });
 
-						if (std::distance(first, max_candle) == bias)
-						{
-							make_level(*max_candle, levels, bias, Candle::Type::local_max);
-						}
+				const auto min_radii = Detector::make_min_radii(prices);
+				const auto max_radii = Detector::make_max_radii(prices);
+
+				Registry registry(levels);
+
+				for (auto i = 0U; i < std::size(candles); ++i)
+				{
+					const auto radius = std::max(min_radii[i], max_radii[i]);
+
+					if (radius >= m_config.level_min_bias)
+					{
+						make_level(candles[i], registry, std::min(radius, m_config.level_max_bias),
+							(min_radii[i] >= m_config.level_min_bias ? Candle::Type::local_min : Candle::Type::local_max));
 					}
 				}
 
 				levels.shrink_to_fit();
 
-				update_levels_strength(levels, candles);
-				update_levels_weakness(levels, candles);
+				Level::raw_points_container_t strength_points(std::size(levels));
+				Level::raw_points_container_t weakness_points(std::size(levels));
+
+				update_levels_strength(levels, candles, strength_points);
+				update_levels_weakness(levels, candles, weakness_points);
+
+				Level::make_points(levels, strength_points, weakness_points);
 
 				return levels;
 			}
@@ -2276,53 +3495,28 @@ namespace solution
 			}
 		}
 
-		void Market::make_level(Candle & extremum, levels_container_t & levels, 
+		void Market::make_level(Candle & extremum, Registry & registry, 
 			std::size_t locality, Candle::Type type) const
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				if (auto iterator = std::find_if(std::begin(levels), std::end(levels),
-						[&extremum](const auto & level) { return (level.begin == extremum.date_time); }); 
-							iterator == std::end(levels))
+				if (auto level = registry.find(extremum.date_time); !level)
 				{
 					auto typical_price = (
 						extremum.price_low  + 
 						extremum.price_high + 
 						extremum.price_close) / 3.0;
 
-					switch (type)
-					{
-					case Candle::Type::local_min:
-					{
-						levels.push_back(Level { extremum.date_time, 
-							typical_price * (1.0 - 2.0 * m_config.level_max_deviation), 
-							typical_price * (1.0 + 0.5 * m_config.level_max_deviation), 
-								locality, {}, {} });
-
-						break;
-					}
-					case Candle::Type::local_max:
-					{
-						levels.push_back(Level { extremum.date_time, 
-							typical_price * (1.0 - 0.5 * m_config.level_max_deviation),
-							typical_price * (1.0 + 2.0 * m_config.level_max_deviation), 
-								locality, {}, {} });
-
-						break;
-					}
-					default:
-					{
-						break;
-					}
-					}
+					registry.insert(Level_Engine::make_level(extremum.date_time, 
+						typical_price, locality, type, m_config.level_max_deviation));
 
 					extremum.type = type;
 				}
 				else
 				{
-					iterator->locality = locality;
+					level->locality = locality;
 				}
 			}
 			catch (const std::exception & exception)
@@ -2332,23 +3526,26 @@ namespace solution
 		}
 
 		void Market::update_levels_strength(levels_container_t & levels,
-			const candles_container_t & candles) const
+			const candles_container_t & candles, Level::raw_points_container_t & points) const
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				for (auto & level : levels)
+				Price_Index price_index(levels);
+
+				for (const auto & candle : candles)
 				{
-					for (const auto & candle : candles)
+					if (candle.type != Candle::Type::empty)
 					{
-						if (candle.date_time > level.begin &&
-							candle.type != Candle::Type::empty &&
-							candle.price_close >= level.price_low &&
-							candle.price_close <= level.price_high)
-						{
-							level.strength_points.push_back(candle.date_time);
-						}
+						const auto timestamp = candle.date_time.to_timestamp();
+
+						price_index.activate(timestamp);
+
+						price_index.stab(candle.price_close, [&levels, &points, timestamp](auto & level)
+							{
+								points[std::distance(levels.data(), &level)].push_back(timestamp);
+							});
 					}
 				}
 			}
@@ -2359,41 +3556,87 @@ namespace solution
 		}
 
 		void Market::update_levels_weakness(levels_container_t & levels,
-			const candles_container_t & candles) const
+			const candles_container_t & candles, Level::raw_points_container_t & points) const
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				for (auto & level : levels)
+				std::vector < std::size_t > extrema;
+
+				for (auto i = 0U; i < std::size(candles); ++i)
 				{
-					for (auto i = 0U; i < std::size(candles); ++i)
+					if (candles[i].type != Candle::Type::empty)
 					{
-						if (candles[i].date_time > level.begin &&
-							candles[i].type != Candle::Type::empty)
-						{
-							for (auto j = i + 1U; j < std::size(candles); ++j)
+						extrema.push_back(i);
+					}
+				}
+
+				Price_Index price_index(levels);
+
+				std::vector < Level * > crossed_levels;
+
+				for (auto e = 1U; e < std::size(extrema); ++e)
+				{
+					const auto i = extrema[e - 1U];
+					const auto j = extrema[e];
+
+					const auto price_i = candles[i].price_close;
+					const auto price_j = candles[j].price_close;
+
+					price_index.activate(candles[i].date_time.to_timestamp());
+
+					crossed_levels.clear();
+
+					if (price_i > price_j) // note: levels crossed from above
+					{
+						price_index.for_each(price_j, price_i, [&crossed_levels, price_i, price_j](auto & level)
 							{
-								if (candles[j].type != Candle::Type::empty)
+								if (price_i > level.price_high && price_j < level.price_low)
 								{
-									for (auto k = i; k <= j; ++k)
-									{
-										if ((candles[i].price_close > level.price_high) &&
-											(candles[j].price_close < level.price_low ) &&
-											(candles[k].price_close < level.price_low ) ||
-											(candles[i].price_close < level.price_low ) &&
-											(candles[j].price_close > level.price_high) && 
-											(candles[k].price_close > level.price_high))
-										{
-											level.weakness_points.push_back(candles[k].date_time);
+									crossed_levels.push_back(&level);
+								}
+							});
 
-											break;
-										}
-									}
+						std::sort(std::begin(crossed_levels), std::end(crossed_levels),
+							[](auto lhs, auto rhs) { return (lhs->price_low > rhs->price_low); });
+
+						auto k = i;
+
+						for (auto level : crossed_levels)
+						{
+							while (!(candles[k].price_close < level->price_low))
+							{
+								++k;
+							}
 
-									break;
+							points[std::distance(levels.data(), level)].push_back(candles[k].date_time.to_timestamp());
+						}
+					}
+
+					if (price_i < price_j) // note: levels crossed from below
+					{
+						price_index.for_each(price_i, price_j, [&crossed_levels, price_i, price_j](auto & level)
+							{
+								if (price_i < level.price_low && price_j > level.price_high)
+								{
+									crossed_levels.push_back(&level);
 								}
+							});
+
+						std::sort(std::begin(crossed_levels), std::end(crossed_levels),
+							[](auto lhs, auto rhs) { return (lhs->price_high < rhs->price_high); });
+
+						auto k = i;
+
+						for (auto level : crossed_levels)
+						{
+							while (!(candles[k].price_close > level->price_high))
+							{
+								++k;
 							}
+
+							points[std::distance(levels.data(), level)].push_back(candles[k].date_time.to_timestamp());
 						}
 					}
 				}
@@ -2410,7 +3653,7 @@ namespace solution
 
 			try
 			{
-				Data::save_supports_resistances(m_supports_resistances);
+				Data::save_supports_resistances(m_supports_resistances, m_executor);
 			}
 			catch (const std::exception & exception)
 			{
@@ -2424,36 +3667,48 @@ namespace solution
 
 			try
 			{
-				std::vector < std::future < void > > futures;
-
-				futures.reserve(std::size(m_assets) * std::size(m_scales));
+				Task_Group group(m_executor);
 
 				for (const auto & asset : m_assets)
 				{
 					for (const auto & scale : m_scales)
 					{
-						std::packaged_task < void() > task([this, asset, scale]()
+						group.run([this, asset, scale]()
 							{
-								auto & candles = m_charts.at(asset).at(scale);
+								update_tags(m_charts.at(asset).at(scale), m_supports_resistances.at(asset));
+							});
+					}
+				}
+
+				group.wait();
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
 
-								update_regression_tags(candles);
+		void Market::update_tags(candles_container_t & candles, const levels_container_t & levels) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				Task_Group group(m_executor); // note: subtasks update disjoint fields
 
-								update_classification_tags(candles);
+				group.run([this, &candles]() { update_regression_tags(candles); });
 
-								update_movement_tags(candles);
+				group.run([this, &candles]() { update_classification_tags(candles); });
 
-								update_supports_resistances(candles, m_supports_resistances.at(asset));
+				group.run([this, &candles]() { update_movement_tags(candles); });
 
-								update_indicators(candles);
+				group.run([this, &candles, &levels]() { update_supports_resistances(candles, levels); });
 
-								update_oscillators(candles);
-							});
+				group.run([this, &candles]() { update_indicators(candles); });
 
-						futures.push_back(boost::asio::post(m_thread_pool, std::move(task)));
-					}
-				}
+				group.run([this, &candles]() { update_oscillators(candles); });
 
-				std::for_each(std::begin(futures), std::end(futures), [](auto & future) { future.wait(); });
+				group.wait();
 			}
 			catch (const std::exception & exception)
 			{
@@ -2467,19 +3722,38 @@ namespace solution
 
 			try
 			{
-				for (auto i = 0U; i < std::size(candles); ++i)
+				const auto size = std::size(candles);
+
+				const auto n_horizons = m_config.regression_horizons;
+
+				if (n_horizons == 0U)
+				{
+					throw std::domain_error("required regression horizons > 0");
+				}
+
+				std::vector < double > prices(size, 0.0);
+
+				for (auto i = 0U; i < size; ++i)
+				{
+					prices[i] = candles[i].price_close;
+
+					candles[i].regression_tags.assign(n_horizons, 0.0);
+				}
+
+				std::vector < double > returns(size, 0.0);
+
+				for (auto horizon = 1U; horizon <= n_horizons; ++horizon) // note: column-wise, contiguous prices
 				{
-					for (auto j = 0U; j < Candle::prediction_range; ++j)
+					const auto last = (size > horizon ? size - horizon : 0U);
+
+					for (auto i = 0U; i < last; ++i)
 					{
-						if (i + j + 1 < std::size(candles))
-						{
-							candles[i].regression_tags[j] = (candles[i + j + 1].price_close -
-								candles[i].price_close) / candles[i].price_close;
-						}
-						else
-						{
-							candles[i].regression_tags[j] = 0.0;
-						}
+						returns[i] = (prices[i + horizon] - prices[i]) / prices[i];
+					}
+
+					for (auto i = 0U; i < last; ++i)
+					{
+						candles[i].regression_tags[horizon - 1U] = returns[i];
 					}
 				}
 			}
@@ -2495,116 +3769,67 @@ namespace solution
 
 			try
 			{
-				const auto min_price_change   = m_config.min_price_change;
-				const auto max_price_rollback = m_config.max_price_rollback;
-
-				for (auto first = std::begin(candles); first != std::end(candles);)
-				{
-					auto flag = false;
-
-					for (auto last = std::next(first); last != std::end(candles); ++last)
-					{
-						auto result = std::minmax_element(first, std::next(last), [](const auto & lhs, const auto & rhs)
-							{
-								return lhs.price_close < rhs.price_close;
-							});
-
-						auto min_price = result.first ->price_close;
-						auto max_price = result.second->price_close;
-
-						auto first_extremum = result.first;
-						auto last_extremum  = result.second;
-
-						if (std::distance(first, result.first) > std::distance(first, result.second))
-						{
-							first_extremum = result.second;
-							last_extremum  = result.first;
-						}
+				using Tag = Candle::Classification_Tag;
 
-						if ((((max_price - min_price) / min_price < min_price_change) ||
-							(result.first  == last) || 
-							(result.second == last) || ((last_extremum != last) &&
-								((max_price - min_price) / min_price > min_price_change) &&
-								(std::abs(last_extremum->price_close - last->price_close) < max_price_rollback *
-									std::abs(first_extremum->price_close - last_extremum->price_close)))) &&
-							(std::abs(last_extremum->price_close - last->price_close) /
-								std::min(last_extremum->price_close, last->price_close) < min_price_change))
-						{
-							continue;
-						}
-
-						if (first_extremum->price_close < last_extremum->price_close)
-						{
-							//sample_classification_tags(candles, first_extremum, "OL");
-							//sample_classification_tags(candles, last_extremum,  "CL");
-
-							first_extremum->classification_tag = "OL";
-							last_extremum->classification_tag  = "CL";
-						}
-						else
-						{
-							//sample_classification_tags(candles, first_extremum, "OS");
-							//sample_classification_tags(candles, last_extremum,  "CS");
-
-							first_extremum->classification_tag = "OS";
-							last_extremum->classification_tag  = "CS";
-						}
+				Zigzag::prices_container_t prices(std::size(candles));
 
-						first = last_extremum;
+				std::transform(std::begin(candles), std::end(candles), std::begin(prices),
+					[](const auto & candle) { return candle.price_close; });
 
-						flag = true;
+				for (const auto & swing : Zigzag(m_config.min_price_change, m_config.max_price_rollback).make_swings(prices))
+				{
+					if (swing.is_long)
+					{
+						//sample_classification_tags(candles, std::next(std::begin(candles), swing.first), Tag::OL);
+						//sample_classification_tags(candles, std::next(std::begin(candles), swing.last),  Tag::CL);
 
-						break;
+						candles[swing.first].classification_tag = Tag::OL;
+						candles[swing.last ].classification_tag = Tag::CL;
 					}
-
-					if (!flag)
+					else
 					{
-						break;
+						//sample_classification_tags(candles, std::next(std::begin(candles), swing.first), Tag::OS);
+						//sample_classification_tags(candles, std::next(std::begin(candles), swing.last),  Tag::CS);
+
+						candles[swing.first].classification_tag = Tag::OS;
+						candles[swing.last ].classification_tag = Tag::CS;
 					}
 				}
 
-				std::string state_tag = State_Tag::C;
+				auto state_tag = Tag::C;
 
 				for (auto & candle : candles)
 				{
-					if (candle.classification_tag.empty())
+					switch (candle.classification_tag)
 					{
-						candle.classification_tag = state_tag;
-					}
-					else
+					case Tag::OL:
+					case Tag::CSOL:
 					{
-						if (candle.classification_tag == "OL")
-						{
-							state_tag = State_Tag::L;
-						}
-
-						if (candle.classification_tag == "CL")
-						{
-							state_tag = State_Tag::C;
-						}
-
-						if (candle.classification_tag == "OS")
-						{
-							state_tag = State_Tag::S;
-						}
-
-						if (candle.classification_tag == "CS")
-						{
-							state_tag = State_Tag::C;
-						}
+						state_tag = Tag::L;
 
-						if (candle.classification_tag == "CSOL")
-						{
-							state_tag = State_Tag::L;
-						}
+						break;
+					}
+					case Tag::OS:
+					case Tag::CLOS:
+					{
+						state_tag = Tag::S;
 
-						if (candle.classification_tag == "CLOS")
-						{
-							state_tag = State_Tag::S;
-						}
+						break;
+					}
+					case Tag::CL:
+					case Tag::CS:
+					{
+						state_tag = Tag::C;
 
-						candle.classification_tag = state_tag;
+						break;
+					}
+					default:
+					{
+						break;
+					}
 					}
+
+					candle.classification_tag = state_tag;
 				}
 			}
 			catch (const std::exception & exception)
@@ -2614,7 +3839,7 @@ namespace solution
 		}
 
 		void Market::sample_classification_tags(candles_container_t & candles,
-			candles_container_t::iterator position, std::string tag) const
+			candles_container_t::iterator position, Candle::Classification_Tag tag) const
 		{
 			RUN_LOGGER(logger);
 
@@ -2654,19 +3879,36 @@ namespace solution
 			}
 		}
 
-		void Market::concat_classification_tags(std::string & target, const std::string & tag) const
+		void Market::concat_classification_tags(Candle::Classification_Tag & target, Candle::Classification_Tag tag) const
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				if ((target.empty()) ||
-					(target == "OL" && tag != "CL") ||
-					(target == "CL" && tag != "OL") ||
-					(target == "OS" && tag != "CS") ||
-					(target == "CS" && tag != "OS"))
+				using Tag = Candle::Classification_Tag;
+
+				if (target == Tag::empty)
+				{
+					target = tag;
+				}
+				else if (
+					(target == Tag::OL && tag != Tag::CL) ||
+					(target == Tag::CL && tag != Tag::OL) ||
+					(target == Tag::OS && tag != Tag::CS) ||
+					(target == Tag::CS && tag != Tag::OS))
 				{
-					target += tag;
+					if (target == Tag::CS && tag == Tag::OL)
+					{
+						target = Tag::CSOL;
+					}
+					else if (target == Tag::CL && tag == Tag::OS)
+					{
+						target = Tag::CLOS;
+					}
+					else
+					{
+						target = Tag::mixed;
+					}
 				}
 			}
 			catch (const std::exception & exception)
@@ -2697,18 +3939,26 @@ namespace solution
 				}
 				*/
 
-				const auto prediction_range = m_config.movement_timesteps;
+				const auto size = std::size(candles);
+
+				std::vector < double > prices_high(size, 0.0);
+				std::vector < double > prices_low (size, 0.0);
 
-				for (auto i = 0U; i < std::size(candles) - prediction_range; ++i)
+				for (auto i = 0U; i < size; ++i)
 				{
-					auto max_price = candles[i + prediction_range].price_high;
-					auto min_price = candles[i + prediction_range].price_low;
+					prices_high[i] = candles[i].price_high;
+					prices_low [i] = candles[i].price_low;
+				}
 
-					for (auto j = 1U; j < prediction_range; ++j)
-					{
-						max_price = std::max(max_price, candles[i + j].price_high);
-						min_price = std::min(min_price, candles[i + j].price_low);
-					}
+				const Window window(m_config.movement_timesteps);
+
+				const auto max_prices = window.make_maxima(prices_high);
+				const auto min_prices = window.make_minima(prices_low );
+
+				for (auto i = 0U; i < std::size(max_prices); ++i)
+				{
+					const auto max_price = max_prices[i];
+					const auto min_price = min_prices[i];
 
 					auto current_price_close = candles[i].price_close;
 
@@ -2741,29 +3991,17 @@ namespace solution
 
 			try
 			{
+				Level_Index level_index(levels);
+
 				for (auto & candle : candles)
 				{
-					for (const auto & level : levels)
-					{
-						if ((candle.date_time.to_time_t() - level.begin.to_time_t()) <
-								seconds_in_day * static_cast < std::time_t > (level.locality))
-						{
-							break;
-						}
-						else
-						{
-							if ((level.price_low  <= candle.price_close) &&
-								(level.price_high >= candle.price_close) && 
-								(level.weakness_to_date(candle.date_time) < 2U))
-							{
-								++candle.n_levels;
+					auto result = level_index.find(candle.date_time, candle.price_close);
 
-								if (candle.level.locality < level.locality)
-								{
-									candle.level = level;
-								}
-							}
-						}
+					candle.n_levels += result.n_levels;
+
+					if (result.level && candle.level.locality < result.level->locality)
+					{
+						candle.level = *result.level;
 					}
 				}
 			}
@@ -2821,126 +4059,131 @@ namespace solution
 			}
 		}
 
-		void Market::prepare_environment_data()
+		void Market::make_local_environment()
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				std::vector < std::future < void > > futures;
-
-				futures.reserve(std::size(m_assets) * std::size(m_scales));
+				const auto epsilon = std::numeric_limits < double > ::epsilon();
 
-				for (const auto & asset : m_assets)
+				const auto partition = [this](const auto & asset, const auto & scale, auto is_test) // note: test asset from test start on
 				{
-					for (const auto & scale : m_scales)
-					{
-						std::packaged_task < void() > task([this, asset, scale]()
-							{
-								auto & candles = m_charts.at(asset).at(scale);
+					const auto min = std::numeric_limits < Date_Time::timestamp_t > ::min();
+					const auto max = std::numeric_limits < Date_Time::timestamp_t > ::max();
 
-								update_regression_tags(candles);
+					const auto split = (asset == m_config.local_environment_test_asset ?
+						Date_Time { static_cast < unsigned int > (m_config.local_environment_test_start), 1U, 1U }.to_timestamp() : max);
 
-								update_classification_tags(candles);
+					return (is_test ? get_candles(asset, scale, split, max) : get_candles(asset, scale, min, split));
+				};
 
-								update_movement_tags(candles);
+				const auto n_features = [](auto current) // note: deviations, then 2 candles of features
+				{
+					return (5U + std::size(current->indicators) + std::size(current->oscillators) +
+						std::size(std::prev(current)->indicators) + std::size(std::prev(current)->oscillators));
+				};
 
-								update_supports_resistances(candles, m_supports_resistances.at(asset));
+				std::size_t n_train = 0U;
+				std::size_t n_test  = 0U;
 
-								update_indicators(candles);
+				std::size_t size = 0U;
 
-								update_oscillators(candles);
-							});
+				for (const auto & [asset, scales] : m_charts)
+				{
+					for (const auto & [scale, candles] : scales)
+					{
+						const auto first = std::next(std::begin(candles), std::min(m_config.skipped_timesteps + 1U, std::size(candles)));
+
+						for (auto is_test : { false, true })
+						{
+							const auto view = partition(asset, scale, is_test);
+
+							for (auto current = std::max(std::begin(view), first); current < std::end(view); ++current)
+							{
+								if (current->n_levels != 0U)
+								{
+									if (n_train + n_test == 0U)
+									{
+										size = n_features(current);
+									}
+									else if (n_features(current) != size)
+									{
+										throw std::logic_error("different sizes of features in " + asset + " " + scale);
+									}
 
-						futures.push_back(boost::asio::post(m_thread_pool, std::move(task)));
+									++(is_test ? n_test : n_train);
+								}
+							}
+						}
 					}
 				}
 
-				std::for_each(std::begin(futures), std::end(futures), [](auto & future) { future.wait(); });
-			}
-			catch (const std::exception & exception)
-			{
-				shared::catch_handler < market_exception > (logger, exception);
-			}
-		}
-
-		void Market::make_local_environment()
-		{
-			RUN_LOGGER(logger);
-
-			try
-			{
-				const auto epsilon = std::numeric_limits < double > ::epsilon();
+				m_environment = Environment(n_train, n_test, size);
 
 				for (const auto & [asset, scales] : m_charts)
 				{
+					const auto asset_id = m_environment.intern(asset);
+
 					for (const auto & [scale, candles] : scales)
 					{
 						const auto price_deviation_multiplier =
 							get_price_deviation_multiplier(scale);
 
-						for (auto i = m_config.skipped_timesteps + 1U; i < std::size(candles); ++i)
+						const auto first = std::next(std::begin(candles), std::min(m_config.skipped_timesteps + 1U, std::size(candles)));
+
+						for (auto is_test : { false, true })
 						{
-							if (candles[i].n_levels != 0U)
-							{
-								Record record;
+							const auto view = partition(asset, scale, is_test);
 
-								record.asset = asset;
-								record.date_time = candles[i].date_time;
-								record.vector.reserve(59U);
-								record.direction = candles[i].movement_tag;
-								record.deviation = candles[i].regression_tags.front();
+							for (auto current = std::max(std::begin(view), first); current < std::end(view); ++current)
+							{
+								if (current->n_levels != 0U)
+								{
+									const auto row = m_environment.insert(is_test, asset_id,
+										current->date_time.to_timestamp(), current->movement_tag, current->regression_tags.front());
 
-								auto price_deviation_1 = candles[i].price_deviation_open * price_deviation_multiplier;
-								auto price_deviation_2 = candles[i].price_deviation      * price_deviation_multiplier;
-								auto price_deviation_3 = candles[i].price_deviation_max  * price_deviation_multiplier;
-								auto price_deviation_4 = candles[i].price_deviation_min  * price_deviation_multiplier;
+									auto features = m_environment.features(row);
 
-								record.vector.push_back(std::min(std::max(price_deviation_1, -1.0), +1.0));
-								record.vector.push_back(std::min(std::max(price_deviation_2, -1.0), +1.0));
-								record.vector.push_back(std::min(std::max(price_deviation_3, +0.0), +1.0));
-								record.vector.push_back(std::min(std::max(price_deviation_3, +0.0), +1.0));
+									auto price_deviation_1 = current->price_deviation_open * price_deviation_multiplier;
+									auto price_deviation_2 = current->price_deviation      * price_deviation_multiplier;
+									auto price_deviation_3 = current->price_deviation_max  * price_deviation_multiplier;
+									auto price_deviation_4 = current->price_deviation_min  * price_deviation_multiplier;
 
-								auto volume_deviation = candles[i].volume_deviation;
+									*features++ = static_cast < Environment::feature_t > (std::min(std::max(price_deviation_1, -1.0), +1.0));
+									*features++ = static_cast < Environment::feature_t > (std::min(std::max(price_deviation_2, -1.0), +1.0));
+									*features++ = static_cast < Environment::feature_t > (std::min(std::max(price_deviation_3, +0.0), +1.0));
+									*features++ = static_cast < Environment::feature_t > (std::min(std::max(price_deviation_3, +0.0), +1.0));
 
-								record.vector.push_back(std::min(std::max(volume_deviation, -1.0), +1.0));
+									auto volume_deviation = current->volume_deviation;
 
-								auto price = std::max(candles[i].price_close, epsilon);
+									*features++ = static_cast < Environment::feature_t > (std::min(std::max(volume_deviation, -1.0), +1.0));
 
-								for (auto j = 0U; j < 2U; ++j)
-								{
-									const auto & candle = candles[i - j];
+									auto price = std::max(current->price_close, epsilon);
 
-									for (auto k = 0U; k < std::size(candle.indicators); ++k)
+									for (auto j = 0U; j < 2U; ++j)
 									{
-										auto deviation = (candle.indicators[k] - price) / price;
+										const auto & candle = *std::prev(current, j);
 
-										record.vector.push_back(std::min(std::max(deviation, -1.0), +1.0));
-									}
+										for (auto k = 0U; k < std::size(candle.indicators); ++k)
+										{
+											auto deviation = (candle.indicators[k] - price) / price;
 
-									for (auto k = 0U; k < std::size(candle.oscillators); ++k)
-									{
-										record.vector.push_back(candle.oscillators[k]);
-									}
-								}
+											*features++ = static_cast < Environment::feature_t > (std::min(std::max(deviation, -1.0), +1.0));
+										}
 
-								if (asset == m_config.local_environment_test_asset &&
-									record.date_time.year >= m_config.local_environment_test_start)
-								{
-									m_environment_test.push_back(std::move(record));
-								}
-								else
-								{
-									m_environment.push_back(std::move(record));
+										for (auto k = 0U; k < std::size(candle.oscillators); ++k)
+										{
+											*features++ = static_cast < Environment::feature_t > (candle.oscillators[k]);
+										}
+									}
 								}
 							}
 						}
 					}
 				}
 
-				m_environment_test.shrink_to_fit();
-
-				m_environment.shrink_to_fit();
+				m_environment.sort(); // note: time index for KNN_Engine exclusion
 			}
 			catch (const std::exception & exception)
 			{
@@ -2954,7 +4197,23 @@ namespace solution
 
 			try
 			{
-				Data::save_environment(m_charts, m_config);
+				Data::save_environment(m_charts, m_calendars, m_config, m_executor);
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::save_dataset() const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				Data::save_environment_dataset(m_charts, m_calendars, m_assets, m_scales, m_config);
+
+				Data::save_tagged_charts_dataset(m_charts, m_calendars, m_assets, m_scales, m_config);
 			}
 			catch (const std::exception & exception)
 			{
@@ -2974,6 +4233,11 @@ namespace solution
 					{
 						m_sources[asset][scale] = std::make_shared < Source > (asset, scale);
 					}
+
+					if (m_sources[asset].count(m_config.level_resolution) == 0U) // note: level engine runs on it
+					{
+						m_sources[asset][m_config.level_resolution] = std::make_shared < Source > (asset, m_config.level_resolution);
+					}
 				}
 			}
 			catch (const std::exception & exception)
@@ -2998,9 +4262,7 @@ namespace solution
 					}
 				}
 
-				std::vector < std::future < void > > futures;
-
-				futures.reserve(std::size(m_assets));
+				Task_Group group(m_executor);
 
 				std::mutex mutex;
 
@@ -3013,28 +4275,102 @@ namespace solution
 						throw std::runtime_error("file " + path.string() + " doesn't exist");
 					}
 
-					std::packaged_task < void() > task([this, path, &mutex, asset, scale, &logger]()
+					group.run([this, path, &mutex, asset, scale, &logger]()
 						{
 							auto candles = load_candles(asset, scale, path);
 
+							Calendar calendar(candles);
+
 							std::scoped_lock lock(mutex);
 
 							if (std::size(candles) > days_in_year)
 							{
 								m_charts[asset][scale] = std::move(candles);
+
+								m_calendars[asset][scale] = std::move(calendar);
 							}
 							else
 							{
 								logger.write(Severity::empty, "candles size exception: " + asset + " " + scale);
 							}
 						});
-
-					futures.push_back(boost::asio::post(m_thread_pool, std::move(task)));
 				}
 
-				std::for_each(std::begin(futures), std::end(futures), [](auto & future) { future.wait(); });
+				group.wait();
 
 				make_supports_resistances();
+
+				make_level_engines();
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::make_level_engines()
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				Level_Engine::Parameters parameters;
+
+				parameters.min_bias = m_config.level_min_bias;
+				parameters.max_bias = m_config.level_max_bias;
+
+				parameters.max_deviation = m_config.level_max_deviation;
+
+				m_level_engines.clear();
+
+				for (const auto & asset : m_assets)
+				{
+					m_level_engines[asset] = std::make_shared < Level_Engine > (
+						m_charts.at(asset).at(m_config.level_resolution), m_supports_resistances.at(asset), parameters);
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		void Market::update_level_engine(const std::string & asset, const std::string & scale,
+			const candles_container_t & candles)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				if (auto iterator = m_level_engines.find(asset); iterator != std::end(m_level_engines))
+				{
+					auto & level_engine = *iterator->second;
+
+					const auto is_covered = (scale == m_config.level_resolution && !std::empty(candles) &&
+						candles.front().date_time.to_timestamp() <= level_engine.last_timestamp());
+
+					candles_container_t resolution_candles; // note: engine runs on level resolution whatever is requested
+
+					if (!is_covered)
+					{
+						resolution_candles = get_current_candles_since(asset, m_config.level_resolution, level_engine.last_timestamp());
+					}
+
+					const auto & level_candles = (is_covered ? candles : resolution_candles);
+
+					if (std::empty(level_candles))
+					{
+						return;
+					}
+
+					for (auto candle = std::begin(level_candles); candle != std::prev(std::end(level_candles)); ++candle) // note: last candle is not closed
+					{
+						if (candle->date_time.to_timestamp() > level_engine.last_timestamp())
+						{
+							level_engine.push(*candle);
+						}
+					}
+				}
 			}
 			catch (const std::exception & exception)
 			{
@@ -3075,54 +4411,47 @@ namespace solution
 			}
 		}
 
-		std::string Market::get_current_data(const std::string & asset, const std::string & scale, std::size_t size)
+		Market::candles_view_t Market::get_candles(const std::string & asset, const std::string & scale,
+			Date_Time::timestamp_t from, Date_Time::timestamp_t to) const
 		{
 			RUN_LOGGER(logger);
 
 			try
 			{
-				const auto epsilon = std::numeric_limits < double > ::epsilon();
-
-				std::istringstream sin(m_sources.at(asset).at(scale)->get(size));
-
-				candles_container_t candles;
-
-				std::string line;
-
-				while (std::getline(sin, line))
-				{
-					auto candle = parse(line);
-
-					if (candle.price_open < epsilon)
-					{
-						throw std::domain_error("required: (price_open > 0.0) for " + asset);
-					}
-
-					if (candle.price_high < epsilon)
-					{
-						throw std::domain_error("required: (price_high > 0.0) for " + asset);
-					}
+				return Calendar::view(m_charts.at(asset).at(scale), m_calendars.at(asset).at(scale).rows(from, to));
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
 
-					if (candle.price_low < epsilon)
-					{
-						throw std::domain_error("required: (price_low > 0.0) for " + asset);
-					}
+		Market::candles_view_t Market::get_last_candles(const std::string & asset, const std::string & scale, std::size_t n) const
+		{
+			RUN_LOGGER(logger);
 
-					if (candle.price_close < epsilon)
-					{
-						throw std::domain_error("required: (price_close > 0.0) for " + asset);
-					}
+			try
+			{
+				return Calendar::view(m_charts.at(asset).at(scale), m_calendars.at(asset).at(scale).last_rows(n));
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
 
-					if (candle.volume == 0ULL)
-					{
-						throw std::domain_error("required: (volume > 0) for " + asset);
-					}
+		std::string Market::get_current_data(const std::string & asset, const std::string & scale, std::size_t size)
+		{
+			RUN_LOGGER(logger);
 
-					candles.push_back(std::move(candle));
-				}
+			try
+			{
+				auto candles = get_current_candles(asset, scale, size);
 
 				update_deviations(asset, scale, candles);
 
+				update_level_engine(asset, scale, candles);
+
 				update_supports_resistances(candles, m_supports_resistances.at(asset));
 
 				update_indicators(candles);
@@ -3195,6 +4524,86 @@ namespace solution
 			}
 		}
 
+		Market::candles_container_t Market::get_current_candles(
+			const std::string & asset, const std::string & scale, std::size_t size) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				const auto epsilon = std::numeric_limits < double > ::epsilon();
+
+				std::istringstream sin(m_sources.at(asset).at(scale)->get(size));
+
+				candles_container_t candles;
+
+				std::string line;
+
+				while (std::getline(sin, line))
+				{
+					auto candle = parse(line);
+
+					if (candle.price_open < epsilon)
+					{
+						throw std::domain_error("required: (price_open > 0.0) for " + asset);
+					}
+
+					if (candle.price_high < epsilon)
+					{
+						throw std::domain_error("required: (price_high > 0.0) for " + asset);
+					}
+
+					if (candle.price_low < epsilon)
+					{
+						throw std::domain_error("required: (price_low > 0.0) for " + asset);
+					}
+
+					if (candle.price_close < epsilon)
+					{
+						throw std::domain_error("required: (price_close > 0.0) for " + asset);
+					}
+
+					if (candle.volume == 0ULL)
+					{
+						throw std::domain_error("required: (volume > 0) for " + asset);
+					}
+
+					candles.push_back(std::move(candle));
+				}
+
+				return candles;
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
+		Market::candles_container_t Market::get_current_candles_since(
+			const std::string & asset, const std::string & scale, Date_Time::timestamp_t since) const
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				const auto available = m_sources.at(asset).at(scale)->size();
+
+				for (std::size_t size = 2U; ; size *= 2U) // note: grows until the window reaches since
+				{
+					auto candles = get_current_candles(asset, scale, std::min(size, available));
+
+					if (std::empty(candles) || size >= available || candles.front().date_time.to_timestamp() <= since)
+					{
+						return candles;
+					}
+				}
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
 		void Market::print_last_candle(const std::string & asset, const candles_container_t & candles) const
 		{
 			RUN_LOGGER(logger);
@@ -3251,7 +4660,7 @@ namespace solution
 					candle.date_time.day / days_in_month << delimeter;
 				*/
 
-				const auto day = day_of_week(candle);
+				const auto day = Calendar::weekday(candle.date_time);
 
 				for (auto j = 0U; j < 5U; ++j)
 				{
@@ -3351,6 +4760,30 @@ namespace solution
 			}
 		}
 
+		Market::Executor::Parameters Market::make_executor_parameters(const Config & config)
+		{
+			RUN_LOGGER(logger);
+
+			try
+			{
+				Executor::Parameters parameters;
+
+				if (config.executor_size != 0U)
+				{
+					parameters.size_policy = Executor::Size_Policy::fixed(config.executor_size);
+				}
+
+				parameters.required_affinity = config.required_thread_affinity;
+				parameters.required_numa     = config.required_numa_placement;
+
+				return parameters;
+			}
+			catch (const std::exception & exception)
+			{
+				shared::catch_handler < market_exception > (logger, exception);
+			}
+		}
+
 		double Market::get_price_deviation_multiplier(const std::string & scale)
 		{
 			RUN_LOGGER(logger);
@@ -45,8 +45,28 @@
 
 #include <nlohmann/json.hpp>
 
+#include "calendar/calendar.hpp"
 #include "candle/candle.hpp"
+#include "dataflow/dataflow.hpp"
+#include "dataset/dataset.hpp"
+#include "environment/environment.hpp"
+#include "event_study/event_study.hpp"
+#include "detector/detector.hpp"
+#include "executor/executor.hpp"
+#include "hnsw_index/hnsw_index.hpp"
+#include "knn_engine/knn_engine.hpp"
+#include "level_engine/level_engine.hpp"
+#include "level_index/level_index.hpp"
+#include "pipeline/pipeline.hpp"
+#include "price_index/price_index.hpp"
+#include "registry/registry.hpp"
+#include "resampler/resampler.hpp"
+#include "scheduler/scheduler.hpp"
 #include "source/source.hpp"
+#include "tracker/tracker.hpp"
+#include "window/window.hpp"
+#include "writer/writer.hpp"
+#include "zigzag/zigzag.hpp"
 
 #include "indicators/indicators.hpp"
 #include "oscillators/oscillators.hpp"
@@ -91,6 +111,50 @@ namespace solution
 
 			using Source = market::Source;
 
+			using Executor = market::Executor;
+
+			using Task_Group = market::Task_Group;
+
+			using Dataflow = market::Dataflow;
+
+			using Dataset = market::Dataset;
+
+			using Environment = market::Environment;
+
+			using KNN_Engine = market::KNN_Engine;
+
+			using HNSW_Index = market::HNSW_Index;
+
+			using Scheduler = market::Scheduler;
+
+			using Detector = market::Detector;
+
+			using Registry = market::Registry;
+
+			using Price_Index = market::Price_Index;
+
+			using Level_Index = market::Level_Index;
+
+			using Level_Engine = market::Level_Engine;
+
+			using Zigzag = market::Zigzag;
+
+			using Calendar = market::Calendar;
+
+			using Event_Study = market::Event_Study;
+
+			using Resampler = market::Resampler;
+
+			using Window = market::Window;
+
+			using Pipeline = market::Pipeline;
+
+			using Buffer = market::Buffer;
+
+			using Writer = market::Writer;
+
+			using Tracker = market::Tracker;
+
 			using assets_container_t = std::vector < std::string > ;
 
 			using scales_container_t = std::vector < std::string > ;
@@ -107,9 +171,16 @@ namespace solution
 			using sources_container_t = std::unordered_map < std::string,
 				std::unordered_map < std::string, std::shared_ptr < Source > > > ;
 
+			using level_engines_container_t = std::unordered_map < std::string, std::shared_ptr < Level_Engine > > ;
+
 			using charts_container_t = std::unordered_map < std::string,
 				std::unordered_map < std::string, candles_container_t > > ;
 
+			using calendars_container_t = std::unordered_map < std::string,
+				std::unordered_map < std::string, Calendar > > ;
+
+			using candles_view_t = boost::iterator_range < candles_container_t::const_iterator > ;
+
 			using self_similarity_matrix_t = boost::multi_array < double, 2U > ;
 
 			using self_similarities_container_t = std::unordered_map < std::string,
@@ -133,26 +204,6 @@ namespace solution
 			using oscillators_container_t =
 				std::vector < std::function < void(candles_container_t &) > > ;
 
-		private:
-
-			struct Record
-			{
-				std::string asset;
-
-				Date_Time date_time;
-
-				std::vector < double > vector;
-
-				int direction;
-
-				double deviation;
-			};
-
-		private:
-
-			using environment_t = std::vector < Record > ;
-
-			using thread_pool_t = boost::asio::thread_pool;
 
 		private:
 
@@ -209,6 +260,43 @@ namespace solution
 
 				using json_t = nlohmann::json;
 
+			public:
+
+				using matrix_t = boost::multi_array < double, 2U > ;
+
+				using labels_container_t = std::vector < std::string > ;
+
+				using matrices_container_t = std::vector < const matrix_t * > ;
+
+				struct Cache // note: matrices and fingerprints of their inputs from the previous run
+				{
+					json_t fingerprints;
+
+					labels_container_t labels;
+					labels_container_t axis_labels;
+
+					std::vector < matrix_t > matrices;
+				};
+
+			private:
+
+				struct Binary // note: native-endian header, then matrices one after another
+				{
+					enum class Layout : std::uint32_t
+					{
+						dense  = 0U, // rows x columns
+						packed = 1U  // upper triangle with diagonal, row by row
+					};
+
+					static inline const std::string magic = "MATRICES"; // 8 bytes
+
+					static inline const std::uint32_t version = 2U;
+
+					static inline const std::uint32_t byte_order = 0x01020304U; // note: reads swapped on other hosts
+
+					static inline const std::size_t alignment = 64U; // payload offset
+				};
+
 			private:
 
 				struct File
@@ -227,6 +315,23 @@ namespace solution
 					static inline const path_t tagged_charts_data        = "market/output/tagged_charts.data";
 					static inline const path_t environment_data          = "market/output/environment.data";
 					static inline const path_t supports_resistances_data = "market/output/supports_resistances.data";
+
+					static inline const path_t environment_dataset   = "market/output/environment";   // note: directory
+					static inline const path_t tagged_charts_dataset = "market/output/tagged_charts"; // note: directory
+
+					static inline const path_t self_similarities_binary    = "market/output/self_similarities.bin";
+					static inline const path_t pair_similarities_binary    = "market/output/pair_similarities.bin";
+					static inline const path_t pair_correlations_binary    = "market/output/pair_correlations.bin";
+					static inline const path_t cumulative_distances_binary = "market/output/cumulative_distances.bin";
+
+					static inline const path_t self_similarities_cache        = "market/cache/self_similarities.bin";
+					static inline const path_t pair_similarities_cache        = "market/cache/pair_similarities.bin";
+					static inline const path_t pair_correlations_cache        = "market/cache/pair_correlations.bin";
+					static inline const path_t self_similarities_fingerprints = "market/cache/self_similarities.data";
+					static inline const path_t pair_similarities_fingerprints = "market/cache/pair_similarities.data";
+					static inline const path_t pair_correlations_fingerprints = "market/cache/pair_correlations.data";
+
+					static inline const path_t environment_index = "market/cache/environment.index";
 				};
 
 			private:
@@ -251,28 +356,88 @@ namespace solution
 
 				static void save_cumulative_distances(const distances_matrix_t & matrix);
 
-				static void save_price_deviations(const charts_container_t & charts);
+				static void save_self_similarities_binary(const self_similarities_container_t & self_similarities,
+					const scales_container_t & scales, bool is_float32);
+
+				static void save_pair_similarities_binary(const pair_similarities_container_t & pair_similarities,
+					const assets_container_t & assets, bool is_float32);
+
+				static void save_pair_correlations_binary(const pair_correlations_container_t & pair_correlations,
+					const assets_container_t & assets, bool is_float32);
+
+				static void save_cumulative_distances_binary(const distances_matrix_t & matrix,
+					const std::string & label, bool is_float32);
+
+				static void load_self_similarities_cache(Cache & cache);
+
+				static void load_pair_similarities_cache(Cache & cache);
+
+				static void load_pair_correlations_cache(Cache & cache);
+
+				static void save_self_similarities_cache(const self_similarities_container_t & self_similarities,
+					const scales_container_t & scales, const json_t & fingerprints);
+
+				static void save_pair_similarities_cache(const pair_similarities_container_t & pair_similarities,
+					const assets_container_t & assets, const json_t & fingerprints);
+
+				static void save_pair_correlations_cache(const pair_correlations_container_t & pair_correlations,
+					const assets_container_t & assets, const json_t & fingerprints);
+
+				static void save_price_deviations(const charts_container_t & charts, Executor & executor);
 
 				static void save_tagged_charts(const charts_container_t & charts, const Config & config); // TODO
 
-				static void save_environment(const charts_container_t & charts, const Config & config);
+				static void save_environment(const charts_container_t & charts, const calendars_container_t & calendars,
+					const Config & config, Executor & executor);
+
+				static void save_supports_resistances(const supports_resistances_container_t & supports_resistances, Executor & executor);
+
+				static void save_environment_dataset(const charts_container_t & charts, const calendars_container_t & calendars,
+					const assets_container_t & assets, const scales_container_t & scales, const Config & config);
 
-				static void save_supports_resistances(const supports_resistances_container_t & supports_resistances);
+				static void save_tagged_charts_dataset(const charts_container_t & charts, const calendars_container_t & calendars,
+					const assets_container_t & assets, const scales_container_t & scales, const Config & config);
+
+				static void save_environment_index(const HNSW_Index & index);
+
+				static void load_environment_index(HNSW_Index & index);
 
 			private:
 
 				static void load(const path_t & path, json_t & object);
 
 				static void save(const path_t & path, const json_t & object);
-			};
 
-		private:
+			private:
 
-			struct State_Tag
-			{
-				static inline const std::string C = "C";
-				static inline const std::string L = "L";
-				static inline const std::string S = "S";
+				static void format(Buffer & buffer, const Date_Time & date_time);
+
+				static void format(Buffer & buffer, const Level & level);
+
+				static void make_labels(Dataset::Row & row, const Candle & candle, bool is_test);
+
+				static json_t make_metadata(const assets_container_t & assets, const scales_container_t & scales);
+
+			private:
+
+				static void save_binary(const path_t & path, const labels_container_t & labels,
+					const labels_container_t & axis_labels, const matrices_container_t & matrices,
+					Binary::Layout layout, bool is_float32);
+
+				template < typename T >
+				static void write_matrix(std::ostream & stream, const matrix_t & matrix, Binary::Layout layout);
+
+				static void load_binary(const path_t & path, labels_container_t & labels,
+					labels_container_t & axis_labels, std::vector < matrix_t > & matrices);
+
+				template < typename T >
+				static void read_matrix(std::istream & stream, matrix_t & matrix, Binary::Layout layout);
+
+				static void load_cache(const path_t & matrices_path, const path_t & fingerprints_path, Cache & cache);
+
+				template < typename Container >
+				static void save_cache(const path_t & matrices_path, const path_t & fingerprints_path,
+					const Container & container, const labels_container_t & axis_labels, const json_t & fingerprints);
 			};
 
 		private:
@@ -285,10 +450,27 @@ namespace solution
 				static inline const std::string M = "MN";
 			};
 
+			struct Stage
+			{
+				static inline const std::string charts               = "charts";
+				static inline const std::string self_similarities    = "self_similarities";
+				static inline const std::string pair_similarities    = "pair_similarities";
+				static inline const std::string pair_correlations    = "pair_correlations";
+				static inline const std::string price_deviations     = "price_deviations";
+				static inline const std::string supports_resistances = "supports_resistances";
+				static inline const std::string levels_output        = "levels_output";
+				static inline const std::string tags                 = "tags";
+				static inline const std::string tagged_charts        = "tagged_charts";
+				static inline const std::string environment          = "environment";
+				static inline const std::string local_environment    = "local_environment";
+				static inline const std::string dataset              = "dataset";
+				static inline const std::string sources              = "sources";
+			};
+
 		public:
 
 			Market(const Config & config) : 
-				m_config(config), m_thread_pool(2U * std::thread::hardware_concurrency())
+				m_config(config), m_executor(Executor::instance(make_executor_parameters(config)))
 			{
 				initialize();
 			}
@@ -311,6 +493,12 @@ namespace solution
 
 			void uninitialize();
 
+		private:
+
+			void make_pipeline();
+
+			Pipeline::names_container_t make_targets() const;
+
 		private:
 
 			void load();
@@ -329,6 +517,8 @@ namespace solution
 
 			void load_charts();
 
+			void make_dataflow();
+
 		private:
 
 			std::pair < path_t, std::size_t > get_all_charts() const;
@@ -359,27 +549,23 @@ namespace solution
 
 			void handle_price_deviations();
 
-			void handle_tagged_charts();
-
-			void handle_environment();
-
-			void handle_local_environment();
-
-			void handle_quik_initialization();
-
 		private:
 
 			void run_local_environment_test() const;
 
+			void run_knn_benchmark() const;
+
 			void run_fridays_test() const;
 
 			void run_mornings_test() const;
 
 			void run_intraday_test() const;
 
-		private:
+			void run_event_study() const;
+
+			Resampler::significances_container_t test_significance(
+				const Event_Study::samples_container_t & samples, double confidence) const;
 
-			double distance(const Record & record_test, const Record & record) const;
 
 		private:
 
@@ -389,6 +575,15 @@ namespace solution
 
 			void compute_pair_correlations();
 
+		private:
+
+			void track_charts(Tracker & tracker, Tracker::fingerprint_t context) const;
+
+			template < typename Key >
+			Scheduler::masks_container_t restore_matrices(const Data::Cache & cache, const Tracker & tracker,
+				const Data::labels_container_t & labels, const Data::labels_container_t & axis_labels,
+				const std::vector < Data::matrix_t * > & matrices, Key key) const;
+
 		private:
 
 			double compute_self_similarity(const std::string & asset,
@@ -408,7 +603,8 @@ namespace solution
 
 			void save_pair_correlations() const;
 
-			void save_cumulative_distances(const distances_matrix_t & matrix) const;
+			void save_cumulative_distances(const distances_matrix_t & matrix, const std::string & asset,
+				const std::string & scale_1, const std::string & scale_2) const;
 
 			void save_price_deviations() const;
 
@@ -420,14 +616,14 @@ namespace solution
 
 			levels_container_t make_levels(candles_container_t & candles) const;
 
-			void make_level(Candle & extremum, levels_container_t & levels, 
+			void make_level(Candle & extremum, Registry & registry, 
 				std::size_t locality, Candle::Type type) const;
 
 			void update_levels_strength(levels_container_t & levels, 
-				const candles_container_t & candles) const;
+				const candles_container_t & candles, Level::raw_points_container_t & points) const;
 
 			void update_levels_weakness(levels_container_t & levels,
-				const candles_container_t & candles) const;
+				const candles_container_t & candles, Level::raw_points_container_t & points) const;
 
 		private:
 
@@ -437,6 +633,8 @@ namespace solution
 
 			void make_tagged_charts();
 
+			void update_tags(candles_container_t & candles, const levels_container_t & levels) const;
+
 		private:
 
 			void update_regression_tags(candles_container_t & candles) const;
@@ -444,9 +642,9 @@ namespace solution
 			void update_classification_tags(candles_container_t & candles) const;
 
 			void sample_classification_tags(candles_container_t & candles, 
-				candles_container_t::iterator position, std::string tag) const;
+				candles_container_t::iterator position, Candle::Classification_Tag tag) const;
 
-			void concat_classification_tags(std::string & target, const std::string & tag) const;
+			void concat_classification_tags(Candle::Classification_Tag & target, Candle::Classification_Tag tag) const;
 
 			void update_movement_tags(candles_container_t & candles) const;
 
@@ -462,10 +660,10 @@ namespace solution
 
 		private:
 
-			void prepare_environment_data();
-
 			void save_environment() const;
 
+			void save_dataset() const;
+
 			void make_local_environment();
 
 		private:
@@ -474,6 +672,10 @@ namespace solution
 
 			void update_supports_resistances();
 
+			void make_level_engines();
+
+			void update_level_engine(const std::string & asset, const std::string & scale, const candles_container_t & candles);
+
 		private:
 
 			path_t get_chart_for_levels(const std::string & asset, const std::string & scale) const;
@@ -495,6 +697,13 @@ namespace solution
 				return m_charts;
 			}
 
+		public:
+
+			candles_view_t get_candles(const std::string & asset, const std::string & scale,
+				Date_Time::timestamp_t from, Date_Time::timestamp_t to) const; // note: [from, to)
+
+			candles_view_t get_last_candles(const std::string & asset, const std::string & scale, std::size_t n) const;
+
 		public:
 
 			std::string get_current_data(const std::string & asset, const std::string & scale, std::size_t size);
@@ -502,6 +711,12 @@ namespace solution
 			std::vector < std::string > get_current_data_variation(
 				const std::string & asset, const std::string & scale, std::size_t size);
 
+		private:
+
+			candles_container_t get_current_candles(const std::string & asset, const std::string & scale, std::size_t size) const;
+
+			candles_container_t get_current_candles_since(const std::string & asset, const std::string & scale, Date_Time::timestamp_t since) const;
+
 		private:
 
 			void print_last_candle(const std::string & asset, const candles_container_t & candles) const;
@@ -510,6 +725,10 @@ namespace solution
 
 			std::string serialize_candles(const candles_container_t & candles) const;
 
+		private:
+
+			static Executor::Parameters make_executor_parameters(const Config & config);
+
 		private:
 
 			static double get_price_deviation_multiplier(const std::string & scale);
@@ -521,6 +740,7 @@ namespace solution
 			static inline const path_t charts_directory = "market/charts";
 			static inline const path_t levels_directory = "market/levels";
 			static inline const path_t output_directory = "market/output";
+			static inline const path_t cache_directory  = "market/cache";
 
 		private:
 
@@ -543,8 +763,12 @@ namespace solution
 
 			sources_container_t m_sources;
 
+			level_engines_container_t m_level_engines;
+
 			charts_container_t m_charts;
 
+			calendars_container_t m_calendars; // note: same keys as m_charts
+
 			self_similarities_container_t m_self_similarities;
 
 			pair_similarities_container_t m_pair_similarities;
@@ -557,11 +781,11 @@ namespace solution
 
 			oscillators_container_t m_oscillators;
 
-			environment_t m_environment;
+			Environment m_environment;
 
-			environment_t m_environment_test;
+			Pipeline m_pipeline;
 
-			thread_pool_t m_thread_pool;
+			Executor & m_executor;
 		};
 
 	} // namespace system
@@ -0,0 +1,214 @@
+#include "pipeline.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void Pipeline::add(const std::string & name, const names_container_t & inputs,
+				const names_container_t & outputs, action_t action)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (m_stages.count(name) != 0U)
+					{
+						throw std::invalid_argument("stage " + name + " already exists");
+					}
+
+					for (const auto & input : inputs)
+					{
+						if (m_stages.count(input) == 0U) // note: inputs before outputs, no cycles
+						{
+							throw std::invalid_argument("stage " + input + " not found");
+						}
+					}
+
+					Stage stage;
+
+					stage.inputs  = inputs;
+					stage.outputs = outputs;
+
+					stage.action = std::move(action);
+
+					m_stages.emplace(name, std::move(stage));
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < pipeline_exception > (logger, exception);
+				}
+			}
+
+			void Pipeline::run(const std::string & name)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					auto & stage = m_stages.at(name);
+
+					for (const auto & input : stage.inputs)
+					{
+						run(input);
+					}
+
+					if (is_outdated(stage))
+					{
+						if (stage.action)
+						{
+							stage.action();
+						}
+
+						stage.input_versions.clear();
+
+						for (const auto & input : stage.inputs)
+						{
+							stage.input_versions.push_back(m_stages.at(input).version);
+						}
+
+						++stage.version;
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < pipeline_exception > (logger, exception);
+				}
+			}
+
+			Pipeline::names_container_t Pipeline::plan(const names_container_t & targets) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					std::unordered_set < std::string > visited;
+					std::unordered_set < std::string > executed;
+
+					names_container_t order;
+
+					for (const auto & target : targets)
+					{
+						visit(target, visited, executed, order);
+					}
+
+					names_container_t stages;
+
+					for (const auto & name : order)
+					{
+						if (executed.count(name) != 0U)
+						{
+							stages.push_back(name);
+						}
+					}
+
+					return stages;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < pipeline_exception > (logger, exception);
+				}
+			}
+
+			void Pipeline::report(std::ostream & stream, const names_container_t & targets) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					std::unordered_set < std::string > visited;
+					std::unordered_set < std::string > executed;
+
+					names_container_t order;
+
+					for (const auto & target : targets)
+					{
+						visit(target, visited, executed, order);
+					}
+
+					const auto print = [&stream](const names_container_t & names)
+					{
+						for (auto i = 0U; i < std::size(names); ++i)
+						{
+							stream << (i == 0U ? "" : ", ") << names[i];
+						}
+					};
+
+					for (const auto & name : order)
+					{
+						const auto & stage = m_stages.at(name);
+
+						const auto status = (!stage.action ? "by inputs" : // note: outputs are produced by input stages
+							(executed.count(name) != 0U ? "execute" : "skip"));
+
+						stream << std::setw(30) << std::left << std::setfill(' ') << name << " " <<
+							std::setw(9) << std::left << std::setfill(' ') << status << " inputs: ";
+
+						print(stage.inputs);
+
+						stream << " outputs: ";
+
+						print(stage.outputs);
+
+						stream << "\n";
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < pipeline_exception > (logger, exception);
+				}
+			}
+
+			bool Pipeline::is_outdated(const Stage & stage) const
+			{
+				if (stage.version == 0U)
+				{
+					return true;
+				}
+
+				for (auto i = 0U; i < std::size(stage.inputs); ++i)
+				{
+					if (stage.input_versions[i] != m_stages.at(stage.inputs[i]).version)
+					{
+						return true;
+					}
+				}
+
+				return false;
+			}
+
+			void Pipeline::visit(const std::string & name, std::unordered_set < std::string > & visited,
+				std::unordered_set < std::string > & executed, names_container_t & order) const
+			{
+				if (visited.count(name) != 0U)
+				{
+					return;
+				}
+
+				visited.insert(name);
+
+				const auto & stage = m_stages.at(name);
+
+				auto is_executed = is_outdated(stage);
+
+				for (const auto & input : stage.inputs)
+				{
+					visit(input, visited, executed, order);
+
+					is_executed = (is_executed || (executed.count(input) != 0U));
+				}
+
+				if (is_executed)
+				{
+					executed.insert(name);
+				}
+
+				order.push_back(name);
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
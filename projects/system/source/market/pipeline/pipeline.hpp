@@ -0,0 +1,107 @@
+#ifndef SOLUTION_SYSTEM_MARKET_PIPELINE_HPP
+#define SOLUTION_SYSTEM_MARKET_PIPELINE_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <iomanip>
+#include <ostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class pipeline_exception : public std::exception
+			{
+			public:
+
+				explicit pipeline_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit pipeline_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~pipeline_exception() noexcept = default;
+			};
+
+			class Pipeline // note: stages run at most once per versions of their inputs
+			{
+			public:
+
+				using action_t = std::function < void() > ;
+
+				using version_t = std::size_t;
+
+				using names_container_t = std::vector < std::string > ;
+
+			private:
+
+				struct Stage
+				{
+					names_container_t inputs;  // note: names of stages
+					names_container_t outputs; // note: names of artifacts, reports only
+
+					action_t action; // note: empty if outputs are produced by inputs
+
+					version_t version = 0U; // note: 0U if never executed
+
+					std::vector < version_t > input_versions;
+				};
+
+				using stages_container_t = std::unordered_map < std::string, Stage > ;
+
+			public:
+
+				Pipeline() = default;
+
+				~Pipeline() noexcept = default;
+
+			public:
+
+				void add(const std::string & name, const names_container_t & inputs,
+					const names_container_t & outputs, action_t action);
+
+				void run(const std::string & name);
+
+			public:
+
+				names_container_t plan(const names_container_t & targets) const;
+
+				void report(std::ostream & stream, const names_container_t & targets) const;
+
+			private:
+
+				bool is_outdated(const Stage & stage) const;
+
+				void visit(const std::string & name, std::unordered_set < std::string > & visited,
+					std::unordered_set < std::string > & executed, names_container_t & order) const;
+
+			private:
+
+				stages_container_t m_stages;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_PIPELINE_HPP
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include "price_index.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void Price_Index::initialize(levels_container_t & levels)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					m_pending_levels.reserve(std::size(levels));
+
+					for (auto & level : levels)
+					{
+						m_pending_levels.emplace_back(level.begin.to_timestamp(), &level);
+
+						if (level.price_low > 0.0)
+						{
+							m_max_ratio = std::max(m_max_ratio, level.price_high / level.price_low);
+						}
+						else
+						{
+							m_max_ratio = std::numeric_limits < double > ::infinity();
+						}
+					}
+
+					std::stable_sort(std::begin(m_pending_levels), std::end(m_pending_levels),
+						[](const auto & lhs, const auto & rhs) { return (lhs.first < rhs.first); });
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < price_index_exception > (logger, exception);
+				}
+			}
+
+			void Price_Index::activate(timestamp_t time)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					for (; m_n_activated_levels < std::size(m_pending_levels) &&
+						m_pending_levels[m_n_activated_levels].first < time; ++m_n_activated_levels)
+					{
+						auto level = m_pending_levels[m_n_activated_levels].second;
+
+						m_active_levels.emplace(level->price_low, level);
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < price_index_exception > (logger, exception);
+				}
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
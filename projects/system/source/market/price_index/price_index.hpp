@@ -0,0 +1,144 @@
+#ifndef SOLUTION_SYSTEM_MARKET_PRICE_INDEX_HPP
+#define SOLUTION_SYSTEM_MARKET_PRICE_INDEX_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <limits>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../candle/candle.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class price_index_exception : public std::exception
+			{
+			public:
+
+				explicit price_index_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit price_index_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~price_index_exception() noexcept = default;
+			};
+
+			class Price_Index // note: levels activated by a sweep over time, ordered by lower prices
+			{
+			public:
+
+				using levels_container_t = std::vector < Level > ;
+
+				using timestamp_t = Date_Time::timestamp_t;
+
+			private:
+
+				using active_levels_container_t = std::multimap < double, Level * > ;
+
+				using pending_levels_container_t = std::vector < std::pair < timestamp_t, Level * > > ;
+
+			public:
+
+				explicit Price_Index(levels_container_t & levels)
+				{
+					initialize(levels);
+				}
+
+				~Price_Index() noexcept = default;
+
+			private:
+
+				void initialize(levels_container_t & levels);
+
+			public:
+
+				void activate(timestamp_t time);
+
+				template < typename Function >
+				void for_each(double price_min, double price_max, Function && function) const;
+
+				template < typename Function >
+				void stab(double price, Function && function) const;
+
+			private:
+
+				pending_levels_container_t m_pending_levels;
+
+				active_levels_container_t m_active_levels;
+
+				std::size_t m_n_activated_levels = 0U;
+
+				double m_max_ratio = 1.0; // note: price_high <= price_low * max_ratio
+			};
+
+			template < typename Function >
+			void Price_Index::for_each(double price_min, double price_max, Function && function) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					for (auto iterator = m_active_levels.lower_bound(price_min);
+						iterator != std::end(m_active_levels) && iterator->first <= price_max; ++iterator)
+					{
+						function(*iterator->second);
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < price_index_exception > (logger, exception);
+				}
+			}
+
+			template < typename Function >
+			void Price_Index::stab(double price, Function && function) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto slack = 1.0 - 4.0 * std::numeric_limits < double > ::epsilon(); // note: rounding of ratios
+
+					auto price_min = (price > 0.0 && m_max_ratio < std::numeric_limits < double > ::infinity() ?
+						price / m_max_ratio * slack : -std::numeric_limits < double > ::infinity());
+
+					for_each(price_min, price, [&function, price](auto & level)
+						{
+							if (level.price_low <= price && price <= level.price_high)
+							{
+								function(level);
+							}
+						});
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < price_index_exception > (logger, exception);
+				}
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_PRICE_INDEX_HPP
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include "quantizer.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void Quantizer::initialize(const Environment::View & view)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto size = std::size(view);
+
+					const auto n_features = view.n_features();
+
+					m_scales.assign(n_features, 0.0F);
+
+					for (auto i = 0U; i < size; ++i)
+					{
+						const auto features = view.features(i);
+
+						for (auto j = 0U; j < n_features; ++j)
+						{
+							m_scales[j] = std::max(m_scales[j], std::abs(features[j]));
+						}
+					}
+
+					for (auto & scale : m_scales)
+					{
+						scale = ((scale > 0.0F) ? scale / max_code : 1.0F);
+					}
+
+					m_codes.resize(size * n_features);
+
+					for (auto i = 0U; i < size; ++i)
+					{
+						const auto features = view.features(i);
+
+						auto codes = m_codes.data() + i * n_features;
+
+						for (auto j = 0U; j < n_features; ++j)
+						{
+							codes[j] = static_cast < code_t > (std::min(std::max(
+								std::round(features[j] / m_scales[j]), -max_code), max_code));
+						}
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < quantizer_exception > (logger, exception);
+				}
+			}
+
+			void Quantizer::make_query(const feature_t * query, std::vector < feature_t > & offsets,
+				std::vector < feature_t > & weights) const
+			{
+				const auto epsilon = std::numeric_limits < double > ::epsilon(); // note: as KNN_Engine::make_scales
+
+				offsets.resize(n_features());
+				weights.resize(n_features());
+
+				for (auto j = 0U; j < n_features(); ++j) // note: |q - c * s| / |q| = |q / s - c| * s / |q|
+				{
+					offsets[j] = query[j] / m_scales[j];
+
+					weights[j] = static_cast < feature_t > (m_scales[j] / std::max(std::abs(static_cast < double > (query[j])), epsilon));
+				}
+			}
+
+			float Quantizer::distance(const feature_t * offsets, const feature_t * weights,
+				const code_t * codes, std::size_t size) noexcept
+			{
+				auto j = 0U;
+
+				auto distance = 0.0F;
+
+#if defined(__AVX2__)
+				const auto mask_8 = _mm256_castsi256_ps(_mm256_set1_epi32(0x7FFFFFFF));
+				const auto ones_8 = _mm256_set1_ps(1.0F);
+
+				auto sum_8 = _mm256_setzero_ps();
+
+				for (; j + 8U <= size; j += 8U)
+				{
+					const auto values = _mm256_cvtepi32_ps(_mm256_cvtepi8_epi32(
+						_mm_loadl_epi64(reinterpret_cast < const __m128i * > (codes + j))));
+
+					const auto difference = _mm256_and_ps(_mm256_sub_ps(_mm256_loadu_ps(offsets + j), values), mask_8);
+
+					sum_8 = _mm256_add_ps(sum_8, _mm256_min_ps(_mm256_mul_ps(difference, _mm256_loadu_ps(weights + j)), ones_8));
+				}
+
+				auto sum_4 = _mm_add_ps(_mm256_castps256_ps128(sum_8), _mm256_extractf128_ps(sum_8, 1));
+#elif defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+				auto sum_4 = _mm_setzero_ps();
+#endif
+
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+				const auto mask_4 = _mm_castsi128_ps(_mm_set1_epi32(0x7FFFFFFF));
+				const auto ones_4 = _mm_set1_ps(1.0F);
+
+				for (; j + 4U <= size; j += 4U)
+				{
+					std::int32_t packed_codes;
+
+					std::memcpy(&packed_codes, codes + j, sizeof(packed_codes));
+
+					auto integers = _mm_cvtsi32_si128(packed_codes); // note: sign extension without SSE4.1
+
+					integers = _mm_unpacklo_epi8 (integers, integers);
+					integers = _mm_unpacklo_epi16(integers, integers);
+					integers = _mm_srai_epi32    (integers, 24);
+
+					const auto difference = _mm_and_ps(_mm_sub_ps(_mm_loadu_ps(offsets + j), _mm_cvtepi32_ps(integers)), mask_4);
+
+					sum_4 = _mm_add_ps(sum_4, _mm_min_ps(_mm_mul_ps(difference, _mm_loadu_ps(weights + j)), ones_4));
+				}
+
+				alignas(16) float sums[4];
+
+				_mm_store_ps(sums, sum_4);
+
+				distance = (sums[0] + sums[1]) + (sums[2] + sums[3]);
+#endif
+
+				for (; j < size; ++j)
+				{
+					distance += std::min(std::abs(offsets[j] - codes[j]) * weights[j], 1.0F);
+				}
+
+				return distance;
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
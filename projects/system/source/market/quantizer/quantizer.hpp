@@ -0,0 +1,120 @@
+#ifndef SOLUTION_SYSTEM_MARKET_QUANTIZER_HPP
+#define SOLUTION_SYSTEM_MARKET_QUANTIZER_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#if defined(__AVX__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <immintrin.h>
+#endif
+
+#include "../environment/environment.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class quantizer_exception : public std::exception
+			{
+			public:
+
+				explicit quantizer_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit quantizer_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~quantizer_exception() noexcept = default;
+			};
+
+			class Quantizer // note: int8 codes with per-feature scale, x ~ code * scale
+			{
+			public:
+
+				using feature_t = Environment::feature_t;
+
+				using code_t = std::int8_t;
+
+			public:
+
+				Quantizer() = default;
+
+				explicit Quantizer(const Environment::View & view)
+				{
+					initialize(view);
+				}
+
+				~Quantizer() noexcept = default;
+
+			private:
+
+				void initialize(const Environment::View & view);
+
+			public:
+
+				bool empty() const noexcept
+				{
+					return std::empty(m_scales);
+				}
+
+				std::size_t n_features() const noexcept
+				{
+					return std::size(m_scales);
+				}
+
+				const code_t * codes(std::size_t row) const noexcept
+				{
+					return m_codes.data() + row * n_features();
+				}
+
+				feature_t scale(std::size_t j) const noexcept
+				{
+					return m_scales[j];
+				}
+
+			public:
+
+				void make_query(const feature_t * query, std::vector < feature_t > & offsets,
+					std::vector < feature_t > & weights) const;
+
+				static float distance(const feature_t * offsets, const feature_t * weights,
+					const code_t * codes, std::size_t size) noexcept;
+
+			private:
+
+				static inline const feature_t max_code = 127.0F;
+
+			private:
+
+				std::vector < feature_t > m_scales;
+
+				std::vector < code_t > m_codes; // note: row-major, rows x n_features
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_QUANTIZER_HPP
\ No newline at end of file
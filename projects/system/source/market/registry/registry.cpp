@@ -0,0 +1,72 @@
+#include "registry.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void Registry::initialize()
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					m_indexes.reserve(std::size(m_levels));
+
+					for (auto i = 0U; i < std::size(m_levels); ++i)
+					{
+						m_indexes.emplace(m_levels[i].begin.to_timestamp(), i);
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < registry_exception > (logger, exception);
+				}
+			}
+
+			Level * Registry::find(const Date_Time & begin)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (auto iterator = m_indexes.find(begin.to_timestamp()); iterator != std::end(m_indexes))
+					{
+						return &m_levels[iterator->second];
+					}
+
+					return nullptr;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < registry_exception > (logger, exception);
+				}
+			}
+
+			Level & Registry::insert(Level && level)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (!m_indexes.emplace(level.begin.to_timestamp(), std::size(m_levels)).second)
+					{
+						throw registry_exception("level already exists");
+					}
+
+					m_levels.push_back(std::move(level));
+
+					return m_levels.back();
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < registry_exception > (logger, exception);
+				}
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,86 @@
+#ifndef SOLUTION_SYSTEM_MARKET_REGISTRY_HPP
+#define SOLUTION_SYSTEM_MARKET_REGISTRY_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../candle/candle.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class registry_exception : public std::exception
+			{
+			public:
+
+				explicit registry_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit registry_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~registry_exception() noexcept = default;
+			};
+
+			class Registry // note: levels in insertion order, indexed by timestamps of beginnings
+			{
+			public:
+
+				using levels_container_t = std::vector < Level > ;
+
+			private:
+
+				using timestamp_t = Date_Time::timestamp_t;
+
+				using indexes_container_t = std::unordered_map < timestamp_t, std::size_t > ;
+
+			public:
+
+				explicit Registry(levels_container_t & levels) : m_levels(levels)
+				{
+					initialize();
+				}
+
+				~Registry() noexcept = default;
+
+			private:
+
+				void initialize();
+
+			public:
+
+				Level * find(const Date_Time & begin);
+
+				Level & insert(Level && level);
+
+			private:
+
+				levels_container_t & m_levels;
+
+				indexes_container_t m_indexes;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_REGISTRY_HPP
\ No newline at end of file
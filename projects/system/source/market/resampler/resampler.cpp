@@ -0,0 +1,222 @@
+#include "resampler.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			Philox::counter_t Philox::generate(counter_t counter, key_t key) noexcept
+			{
+				for (auto round = 0U; round < n_rounds; ++round)
+				{
+					const auto product_0 = static_cast < std::uint64_t > (multiplier_0) * counter[0];
+					const auto product_1 = static_cast < std::uint64_t > (multiplier_1) * counter[2];
+
+					counter = counter_t {
+						static_cast < std::uint32_t > (product_1 >> 32U) ^ counter[1] ^ key[0],
+						static_cast < std::uint32_t > (product_1),
+						static_cast < std::uint32_t > (product_0 >> 32U) ^ counter[3] ^ key[1],
+						static_cast < std::uint32_t > (product_0) };
+
+					key[0] += weyl_0;
+					key[1] += weyl_1;
+				}
+
+				return counter;
+			}
+
+			void Resampler::initialize() const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (m_parameters.n_resamples == 0U)
+					{
+						throw std::domain_error("required n_resamples > 0");
+					}
+
+					if (m_parameters.confidence <= 0.0 || m_parameters.confidence >= 1.0)
+					{
+						throw std::domain_error("required confidence in (0, 1)");
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < resampler_exception > (logger, exception);
+				}
+			}
+
+			Resampler::significances_container_t Resampler::run(const samples_container_t & samples) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					const auto n_resamples = m_parameters.n_resamples;
+
+					const auto n_chunks = (n_resamples + chunk_size - 1U) / chunk_size;
+
+					std::vector < std::vector < double > > bootstrap_means  (std::size(samples));
+					std::vector < std::vector < double > > permutation_means(std::size(samples));
+
+					Task_Group group(m_executor);
+
+					for (auto index = 0U; index < std::size(samples); ++index)
+					{
+						const auto & sample = samples[index];
+
+						if (std::empty(sample.events))
+						{
+							continue;
+						}
+
+						if (std::size(sample.population) < std::size(sample.events))
+						{
+							throw resampler_exception("population is smaller than events in sample " + std::to_string(index));
+						}
+
+						bootstrap_means  [index].resize(n_resamples);
+						permutation_means[index].resize(n_resamples);
+
+						for (auto chunk = 0U; chunk < n_chunks; ++chunk) // note: streams depend on indices only, not on tasks
+						{
+							group.run([this, &sample, &bootstrap_means, &permutation_means, index, chunk, n_resamples]()
+								{
+									auto population = sample.population; // note: restored after each resample
+
+									std::vector < std::size_t > swaps;
+
+									const auto first = chunk * chunk_size;
+									const auto last  = std::min(first + chunk_size, n_resamples);
+
+									for (auto resample = first; resample < last; ++resample)
+									{
+										bootstrap_means  [index][resample] = bootstrap  (sample, index, resample);
+										permutation_means[index][resample] = permutation(sample, index, resample, population, swaps);
+									}
+								});
+						}
+					}
+
+					group.get();
+
+					significances_container_t significances(std::size(samples));
+
+					for (auto index = 0U; index < std::size(samples); ++index)
+					{
+						const auto & sample = samples[index];
+
+						auto & significance = significances[index];
+
+						significance.n_events = std::size(sample.events);
+
+						if (std::empty(sample.events))
+						{
+							continue;
+						}
+
+						significance.mean = std::accumulate(std::begin(sample.events),
+							std::end(sample.events), 0.0) / std::size(sample.events);
+
+						significance.mean_population = std::accumulate(std::begin(sample.population),
+							std::end(sample.population), 0.0) / std::size(sample.population);
+
+						auto & means = bootstrap_means[index];
+
+						const auto alpha = (1.0 - m_parameters.confidence) / 2.0;
+
+						const auto lower = static_cast < std::size_t > (std::floor(alpha * (n_resamples - 1U)));
+						const auto upper = static_cast < std::size_t > (std::ceil((1.0 - alpha) * (n_resamples - 1U)));
+
+						std::nth_element(std::begin(means), std::next(std::begin(means), lower), std::end(means));
+
+						significance.lower = means[lower];
+
+						std::nth_element(std::begin(means), std::next(std::begin(means), upper), std::end(means));
+
+						significance.upper = means[upper];
+
+						const auto observed = std::abs(significance.mean - significance.mean_population);
+
+						const auto tolerance = 1e-12 * std::max(1.0, observed); // note: ties count as extreme
+
+						const auto n_extremes = std::count_if(std::begin(permutation_means[index]), std::end(permutation_means[index]),
+							[&significance, observed, tolerance](auto mean)
+								{ return (std::abs(mean - significance.mean_population) >= observed - tolerance); });
+
+						significance.p_value = (1.0 + n_extremes) / (1.0 + n_resamples);
+					}
+
+					return significances;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < resampler_exception > (logger, exception);
+				}
+			}
+
+			double Resampler::bootstrap(const Sample & sample, std::size_t index, std::size_t resample) const
+			{
+				const auto size = std::size(sample.events);
+
+				auto sum = 0.0;
+
+				for (auto j = 0U; j < size; j += 4U)
+				{
+					const auto random = Philox::generate({ static_cast < std::uint32_t > (j / 4U),
+						static_cast < std::uint32_t > (resample), static_cast < std::uint32_t > (Stream::bootstrap),
+						static_cast < std::uint32_t > (index) }, key());
+
+					for (auto k = 0U; k < 4U && j + k < size; ++k)
+					{
+						sum += sample.events[Philox::index(random[k], size)];
+					}
+				}
+
+				return sum / size;
+			}
+
+			double Resampler::permutation(const Sample & sample, std::size_t index, std::size_t resample,
+				std::vector < double > & population, std::vector < std::size_t > & swaps) const
+			{
+				const auto size = std::size(population);
+
+				const auto n_events = std::size(sample.events);
+
+				swaps.resize(n_events);
+
+				auto sum = 0.0;
+
+				for (auto j = 0U; j < n_events; j += 4U) // note: partial Fisher-Yates, undone below
+				{
+					const auto random = Philox::generate({ static_cast < std::uint32_t > (j / 4U),
+						static_cast < std::uint32_t > (resample), static_cast < std::uint32_t > (Stream::permutation),
+						static_cast < std::uint32_t > (index) }, key());
+
+					for (auto k = 0U; k < 4U && j + k < n_events; ++k)
+					{
+						const auto i = j + k;
+
+						swaps[i] = i + Philox::index(random[k], size - i);
+
+						std::swap(population[i], population[swaps[i]]);
+
+						sum += population[i];
+					}
+				}
+
+				for (auto i = n_events; i-- > 0U; )
+				{
+					std::swap(population[i], population[swaps[i]]);
+				}
+
+				return sum / n_events;
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
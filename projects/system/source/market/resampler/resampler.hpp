@@ -0,0 +1,167 @@
+#ifndef SOLUTION_SYSTEM_MARKET_RESAMPLER_HPP
+#define SOLUTION_SYSTEM_MARKET_RESAMPLER_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <numeric>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../executor/executor.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class resampler_exception : public std::exception
+			{
+			public:
+
+				explicit resampler_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit resampler_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~resampler_exception() noexcept = default;
+			};
+
+			class Philox // note: counter-based generator Philox4x32-10, same output for same counter and key
+			{
+			public:
+
+				using counter_t = std::array < std::uint32_t, 4U > ;
+
+				using key_t = std::array < std::uint32_t, 2U > ;
+
+			public:
+
+				static counter_t generate(counter_t counter, key_t key) noexcept;
+
+				static std::size_t index(std::uint32_t random, std::size_t size) noexcept // note: multiply-shift
+				{
+					return static_cast < std::size_t > ((static_cast < std::uint64_t > (random) * size) >> 32U);
+				}
+
+			private:
+
+				static inline const std::uint32_t multiplier_0 = 0xD2511F53U;
+				static inline const std::uint32_t multiplier_1 = 0xCD9E8D57U;
+
+				static inline const std::uint32_t weyl_0 = 0x9E3779B9U;
+				static inline const std::uint32_t weyl_1 = 0xBB67AE85U;
+
+				static inline const std::size_t n_rounds = 10U;
+			};
+
+			class Resampler // note: bootstrap intervals and permutation p-values for the mean of events
+			{
+			public:
+
+				struct Parameters
+				{
+					std::size_t n_resamples = 10000U;
+
+					double confidence = 0.95;
+
+					std::uint64_t seed = 0ULL;
+				};
+
+				struct Sample
+				{
+					std::vector < double > events;
+
+					std::vector < double > population; // note: pool of candidates the events were drawn from
+				};
+
+				using samples_container_t = std::vector < Sample > ;
+
+				struct Significance
+				{
+					std::size_t n_events = 0U;
+
+					double mean = 0.0; // note: events
+					double mean_population = 0.0;
+
+					double lower = 0.0; // note: bootstrap percentile interval
+					double upper = 0.0;
+
+					double p_value = 1.0; // note: two-sided, random subsets of population of the same size
+				};
+
+				using significances_container_t = std::vector < Significance > ;
+
+			private:
+
+				enum class Stream : std::uint32_t
+				{
+					bootstrap,
+					permutation
+				};
+
+			public:
+
+				explicit Resampler(Executor & executor, const Parameters & parameters) :
+					m_executor(executor), m_parameters(parameters)
+				{
+					initialize();
+				}
+
+				~Resampler() noexcept = default;
+
+			private:
+
+				void initialize() const;
+
+			public:
+
+				significances_container_t run(const samples_container_t & samples) const;
+
+			private:
+
+				double bootstrap(const Sample & sample, std::size_t index, std::size_t resample) const;
+
+				double permutation(const Sample & sample, std::size_t index, std::size_t resample,
+					std::vector < double > & population, std::vector < std::size_t > & swaps) const;
+
+				Philox::key_t key() const noexcept
+				{
+					return { static_cast < std::uint32_t > (m_parameters.seed), static_cast < std::uint32_t > (m_parameters.seed >> 32U) };
+				}
+
+			private:
+
+				static inline const std::size_t chunk_size = 256U; // note: resamples per task
+
+			private:
+
+				Executor & m_executor;
+
+				const Parameters m_parameters;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_RESAMPLER_HPP
\ No newline at end of file
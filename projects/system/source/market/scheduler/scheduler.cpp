@@ -0,0 +1,97 @@
+#include "scheduler.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void Scheduler::initialize() const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (m_tile_size == 0U)
+					{
+						throw std::domain_error("required: (tile_size > 0)");
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < scheduler_exception > (logger, exception);
+				}
+			}
+
+			Scheduler::tiles_container_t Scheduler::make_tiles(std::size_t n_matrices, std::size_t size,
+				const masks_container_t & masks) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					tiles_container_t tiles;
+
+					const auto n_blocks = (size + m_tile_size - 1U) / m_tile_size;
+
+					tiles.reserve(n_matrices * n_blocks * (n_blocks + 1U) / 2U);
+
+					for (auto matrix = 0U; matrix < n_matrices; ++matrix)
+					{
+						for (auto row_first = 0U; row_first < size; row_first += m_tile_size)
+						{
+							for (auto column_first = row_first; column_first < size; column_first += m_tile_size)
+							{
+								Tile tile;
+
+								tile.matrix = matrix;
+
+								tile.row_first = row_first;
+								tile.row_last  = std::min(row_first + m_tile_size, size);
+
+								tile.column_first = column_first;
+								tile.column_last  = std::min(column_first + m_tile_size, size);
+
+								if (std::empty(masks) ||
+									is_dirty(masks[matrix], tile.row_first,    tile.row_last) ||
+									is_dirty(masks[matrix], tile.column_first, tile.column_last))
+								{
+									tiles.push_back(tile);
+								}
+							}
+						}
+					}
+
+					return tiles;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < scheduler_exception > (logger, exception);
+				}
+			}
+
+			bool Scheduler::is_dirty(const mask_t & mask, std::size_t first, std::size_t last) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (std::size(mask) < last)
+					{
+						throw std::out_of_range("required: (size(mask) >= last)");
+					}
+
+					return std::any_of(std::next(std::begin(mask), first), std::next(std::begin(mask), last),
+						[](auto is_changed) { return is_changed; });
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < scheduler_exception > (logger, exception);
+				}
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,182 @@
+#ifndef SOLUTION_SYSTEM_MARKET_SCHEDULER_HPP
+#define SOLUTION_SYSTEM_MARKET_SCHEDULER_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "../executor/executor.hpp"
+#include "../latch/latch.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class scheduler_exception : public std::exception
+			{
+			public:
+
+				explicit scheduler_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit scheduler_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~scheduler_exception() noexcept = default;
+			};
+
+			class Scheduler
+			{
+			public:
+
+				struct Tile
+				{
+					std::size_t matrix = 0U;
+
+					std::size_t row_first = 0U;
+					std::size_t row_last  = 0U;
+
+					std::size_t column_first = 0U;
+					std::size_t column_last  = 0U;
+				};
+
+			public:
+
+				using mask_t = std::vector < bool > ; // note: rows and columns to be recomputed
+
+				using masks_container_t = std::vector < mask_t > ;
+
+			private:
+
+				using tiles_container_t = std::vector < Tile > ;
+
+			public:
+
+				explicit Scheduler(std::size_t tile_size = default_tile_size) : m_tile_size(tile_size)
+				{
+					initialize();
+				}
+
+				~Scheduler() noexcept = default;
+
+			private:
+
+				void initialize() const;
+
+			public:
+
+				template < typename Function >
+				void run(Executor & executor, std::size_t n_matrices, std::size_t size, Function && function) const
+				{
+					run(executor, n_matrices, size, std::forward < Function > (function), masks_container_t());
+				}
+
+				template < typename Function >
+				void run(Executor & executor, std::size_t n_matrices, std::size_t size, Function && function,
+					const masks_container_t & masks) const;
+
+			private:
+
+				tiles_container_t make_tiles(std::size_t n_matrices, std::size_t size, const masks_container_t & masks) const;
+
+				bool is_dirty(const mask_t & mask, std::size_t first, std::size_t last) const;
+
+			private:
+
+				static inline const std::size_t default_tile_size = 16U; // charts of rows and columns stay cached
+
+			private:
+
+				std::size_t m_tile_size;
+			};
+
+			template < typename Function >
+			void Scheduler::run(Executor & executor, std::size_t n_matrices, std::size_t size, Function && function,
+				const masks_container_t & masks) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (!std::empty(masks) && std::size(masks) != n_matrices)
+					{
+						throw std::domain_error("required: (size(masks) == n_matrices)");
+					}
+
+					const auto tiles = make_tiles(n_matrices, size, masks);
+
+					Latch latch(std::size(tiles));
+
+					std::exception_ptr exception_ptr;
+
+					std::mutex mutex;
+
+					for (const auto & tile : tiles)
+					{
+						executor.post([&function, &masks, &latch, &exception_ptr, &mutex, tile]()
+							{
+								try
+								{
+									for (auto i = tile.row_first; i < tile.row_last; ++i)
+									{
+										for (auto j = std::max(i + 1U, tile.column_first); j < tile.column_last; ++j)
+										{
+											if (std::empty(masks) || masks[tile.matrix][i] || masks[tile.matrix][j])
+											{
+												function(tile.matrix, i, j);
+											}
+										}
+									}
+								}
+								catch (...)
+								{
+									std::scoped_lock lock(mutex);
+
+									if (!exception_ptr)
+									{
+										exception_ptr = std::current_exception();
+									}
+								}
+
+								latch.count_down();
+							});
+					}
+
+					executor.wait(latch);
+
+					if (exception_ptr)
+					{
+						std::rethrow_exception(exception_ptr);
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < scheduler_exception > (logger, exception);
+				}
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_SCHEDULER_HPP
\ No newline at end of file
@@ -113,6 +113,22 @@ namespace solution
 				}
 			}
 
+			std::size_t Source::size() const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					boost::interprocess::scoped_lock lock(*m_mutex);
+
+					return m_deque->size();
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < source_exception > (logger, exception);
+				}
+			}
+
 		} // namespace market
 
 	} // namespace system
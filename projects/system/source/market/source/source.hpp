@@ -118,6 +118,8 @@ namespace solution
 
 				std::string get(std::size_t size) const;
 
+				std::size_t size() const;
+
 			private:
 
 				const std::string m_asset;
@@ -0,0 +1,131 @@
+#include "tracker.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void Tracker::initialize(const json_t & fingerprints)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (fingerprints.is_object())
+					{
+						for (const auto & [key, fingerprint] : fingerprints.items())
+						{
+							m_previous_fingerprints[key] = fingerprint.get < fingerprint_t > ();
+						}
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < tracker_exception > (logger, exception);
+				}
+			}
+
+			Tracker::fingerprint_t Tracker::hash(const void * data, std::size_t size, fingerprint_t seed) noexcept
+			{
+				auto bytes = static_cast < const unsigned char * > (data);
+
+				for (auto i = 0U; i < size; ++i)
+				{
+					seed = (seed ^ bytes[i]) * prime;
+				}
+
+				return seed;
+			}
+
+			Tracker::fingerprint_t Tracker::hash(const candles_container_t & candles) noexcept
+			{
+				auto size = std::size(candles);
+
+				auto fingerprint = hash(&size, sizeof(size));
+
+				for (const auto & candle : candles)
+				{
+					fingerprint = hash(&candle.price_deviation, sizeof(candle.price_deviation), fingerprint);
+				}
+
+				return fingerprint;
+			}
+
+			void Tracker::update(const std::string & key, fingerprint_t fingerprint)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					m_current_fingerprints[key] = fingerprint;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < tracker_exception > (logger, exception);
+				}
+			}
+
+			void Tracker::update(const std::string & key, const candles_container_t & candles)
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					update(key, hash(candles));
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < tracker_exception > (logger, exception);
+				}
+			}
+
+			bool Tracker::is_changed(const std::string & key) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					auto current = m_current_fingerprints.find(key);
+
+					if (current == std::end(m_current_fingerprints))
+					{
+						throw tracker_exception("unknown key " + key);
+					}
+
+					auto previous = m_previous_fingerprints.find(key);
+
+					return ((previous == std::end(m_previous_fingerprints)) || (previous->second != current->second));
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < tracker_exception > (logger, exception);
+				}
+			}
+
+			Tracker::json_t Tracker::fingerprints() const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					json_t fingerprints = json_t::object();
+
+					for (const auto & [key, fingerprint] : m_current_fingerprints)
+					{
+						fingerprints[key] = fingerprint;
+					}
+
+					return fingerprints;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < tracker_exception > (logger, exception);
+				}
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
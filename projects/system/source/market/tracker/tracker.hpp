@@ -0,0 +1,109 @@
+#ifndef SOLUTION_SYSTEM_MARKET_TRACKER_HPP
+#define SOLUTION_SYSTEM_MARKET_TRACKER_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <nlohmann/json.hpp>
+
+#include "../candle/candle.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class tracker_exception : public std::exception
+			{
+			public:
+
+				explicit tracker_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit tracker_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~tracker_exception() noexcept = default;
+			};
+
+			class Tracker // note: FNV-1a fingerprints of inputs, compared with the previous run
+			{
+			public:
+
+				using fingerprint_t = std::uint64_t;
+
+				using json_t = nlohmann::json;
+
+				using candles_container_t = std::vector < Candle > ;
+
+			private:
+
+				using fingerprints_container_t = std::unordered_map < std::string, fingerprint_t > ;
+
+			public:
+
+				explicit Tracker(const json_t & fingerprints)
+				{
+					initialize(fingerprints);
+				}
+
+				~Tracker() noexcept = default;
+
+			private:
+
+				void initialize(const json_t & fingerprints);
+
+			public:
+
+				static inline const std::string context_key = "context"; // note: parameters of computations
+
+			public:
+
+				static fingerprint_t hash(const void * data, std::size_t size, fingerprint_t seed = offset_basis) noexcept;
+
+				static fingerprint_t hash(const candles_container_t & candles) noexcept;
+
+			public:
+
+				void update(const std::string & key, fingerprint_t fingerprint);
+
+				void update(const std::string & key, const candles_container_t & candles);
+
+				bool is_changed(const std::string & key) const;
+
+				json_t fingerprints() const;
+
+			private:
+
+				static inline const fingerprint_t offset_basis = 14695981039346656037ULL;
+				static inline const fingerprint_t prime        = 1099511628211ULL;
+
+			private:
+
+				fingerprints_container_t m_previous_fingerprints;
+				fingerprints_container_t m_current_fingerprints;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_TRACKER_HPP
\ No newline at end of file
@@ -0,0 +1,101 @@
+#include "window.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			void Window::initialize() const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					if (m_timesteps == 0U)
+					{
+						throw std::domain_error("required timesteps > 0");
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < window_exception > (logger, exception);
+				}
+			}
+
+			Window::values_container_t Window::make_maxima(const values_container_t & values) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					return make_extrema(values, std::greater_equal < double > ());
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < window_exception > (logger, exception);
+				}
+			}
+
+			Window::values_container_t Window::make_minima(const values_container_t & values) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					return make_extrema(values, std::less_equal < double > ());
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < window_exception > (logger, exception);
+				}
+			}
+
+			template < typename Compare >
+			Window::values_container_t Window::make_extrema(const values_container_t & values, Compare compare) const
+			{
+				const auto size = std::size(values);
+
+				if (size <= m_timesteps)
+				{
+					return values_container_t();
+				}
+
+				values_container_t extrema(size - m_timesteps);
+
+				std::vector < std::size_t > queue; // note: indexes of decreasing (increasing) values
+
+				queue.reserve(size);
+
+				auto head = 0U;
+
+				for (auto last = 1U; last < size; ++last)
+				{
+					while ((std::size(queue) > head) && compare(values[last], values[queue.back()]))
+					{
+						queue.pop_back();
+					}
+
+					queue.push_back(last);
+
+					if (last >= m_timesteps)
+					{
+						const auto first = last - m_timesteps; // note: window (first, last]
+
+						if (queue[head] <= first)
+						{
+							++head;
+						}
+
+						extrema[first] = values[queue[head]];
+					}
+				}
+
+				return extrema;
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
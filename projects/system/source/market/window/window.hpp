@@ -0,0 +1,81 @@
+#ifndef SOLUTION_SYSTEM_MARKET_WINDOW_HPP
+#define SOLUTION_SYSTEM_MARKET_WINDOW_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class window_exception : public std::exception
+			{
+			public:
+
+				explicit window_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit window_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~window_exception() noexcept = default;
+			};
+
+			class Window // note: forward-looking extrema of values (i, i + timesteps], monotonic queue
+			{
+			public:
+
+				using values_container_t = std::vector < double > ;
+
+			public:
+
+				explicit Window(std::size_t timesteps) : m_timesteps(timesteps)
+				{
+					initialize();
+				}
+
+				~Window() noexcept = default;
+
+			private:
+
+				void initialize() const;
+
+			public:
+
+				values_container_t make_maxima(const values_container_t & values) const;
+
+				values_container_t make_minima(const values_container_t & values) const;
+
+			private:
+
+				template < typename Compare >
+				values_container_t make_extrema(const values_container_t & values, Compare compare) const;
+
+			private:
+
+				const std::size_t m_timesteps;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_WINDOW_HPP
\ No newline at end of file
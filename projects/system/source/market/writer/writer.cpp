@@ -0,0 +1,163 @@
+#include "writer.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			Buffer & Buffer::append(unsigned long long value, std::size_t width, char fill)
+			{
+				std::array < char, max_size > buffer;
+
+				const auto last = std::to_chars(buffer.data(), buffer.data() + max_size, value).ptr;
+
+				const auto size = static_cast < std::size_t > (last - buffer.data());
+
+				if (size < width)
+				{
+					m_data.append(width - size, fill);
+				}
+
+				m_data.append(buffer.data(), size);
+
+				return *this;
+			}
+
+			Buffer & Buffer::append(long long value, bool showpos)
+			{
+				std::array < char, max_size > buffer;
+
+				const auto last = std::to_chars(buffer.data(), buffer.data() + max_size, value).ptr;
+
+				if (showpos && value >= 0LL)
+				{
+					m_data.push_back('+');
+				}
+
+				m_data.append(buffer.data(), last);
+
+				return *this;
+			}
+
+			Buffer & Buffer::append(double value, int precision, bool showpos)
+			{
+				std::array < char, max_size > buffer;
+
+				const auto result = std::to_chars(buffer.data(), buffer.data() + max_size,
+					value, std::chars_format::fixed, precision);
+
+				if (result.ec != std::errc())
+				{
+					throw writer_exception("cannot format value with precision " + std::to_string(precision));
+				}
+
+				if (showpos && !std::signbit(value))
+				{
+					m_data.push_back('+');
+				}
+
+				m_data.append(buffer.data(), result.ptr);
+
+				return *this;
+			}
+
+			void Writer::write(const path_t & path, std::size_t n_blocks, formatter_t formatter) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					std::fstream fout(path.string(), std::ios::out | std::ios::trunc);
+
+					if (!fout)
+					{
+						throw writer_exception("cannot open file " + path.string());
+					}
+
+					std::vector < Buffer > buffers(n_blocks);
+
+					std::vector < char > is_ready(n_blocks, 0); // note: guarded by mutex
+
+					auto is_failed = false;
+
+					std::mutex mutex;
+
+					std::condition_variable condition;
+
+					std::thread writer([&]()
+						{
+							for (auto i = 0U; i < n_blocks; ++i)
+							{
+								{
+									std::unique_lock lock(mutex);
+
+									condition.wait(lock, [&]() { return (is_ready[i] || is_failed); });
+
+									if (!is_ready[i])
+									{
+										return;
+									}
+								}
+
+								fout.write(buffers[i].data(), buffers[i].size());
+
+								buffers[i] = Buffer(); // note: releases memory of written block
+							}
+						});
+
+					Task_Group group(m_executor);
+
+					for (auto i = 0U; i < n_blocks; ++i)
+					{
+						group.run([&, i]()
+							{
+								try
+								{
+									formatter(i, buffers[i]);
+								}
+								catch (...)
+								{
+									{
+										std::scoped_lock lock(mutex);
+
+										is_failed = true;
+									}
+
+									condition.notify_all();
+
+									throw;
+								}
+
+								{
+									std::scoped_lock lock(mutex);
+
+									is_ready[i] = 1;
+								}
+
+								condition.notify_all();
+							});
+					}
+
+					group.wait();
+
+					writer.join();
+
+					group.get();
+
+					if (!fout)
+					{
+						throw writer_exception("cannot write file " + path.string());
+					}
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < writer_exception > (logger, exception);
+				}
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
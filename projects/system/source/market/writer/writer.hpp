@@ -0,0 +1,137 @@
+#ifndef SOLUTION_SYSTEM_MARKET_WRITER_HPP
+#define SOLUTION_SYSTEM_MARKET_WRITER_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <array>
+#include <charconv>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <boost/noncopyable.hpp>
+
+#include "../executor/executor.hpp"
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class writer_exception : public std::exception
+			{
+			public:
+
+				explicit writer_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit writer_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~writer_exception() noexcept = default;
+			};
+
+			class Buffer // note: std::to_chars, same output as std::ostream with std::fixed
+			{
+			public:
+
+				explicit Buffer(std::size_t capacity = 0U)
+				{
+					m_data.reserve(capacity);
+				}
+
+				~Buffer() noexcept = default;
+
+			public:
+
+				Buffer & append(char c)
+				{
+					m_data.push_back(c);
+
+					return *this;
+				}
+
+				Buffer & append(std::string_view string)
+				{
+					m_data.append(string);
+
+					return *this;
+				}
+
+				Buffer & append(unsigned long long value, std::size_t width = 0U, char fill = '0');
+
+				Buffer & append(long long value, bool showpos);
+
+				Buffer & append(double value, int precision, bool showpos);
+
+			public:
+
+				const char * data() const noexcept
+				{
+					return m_data.data();
+				}
+
+				std::size_t size() const noexcept
+				{
+					return std::size(m_data);
+				}
+
+			private:
+
+				static inline const std::size_t max_size = 512U; // note: DBL_MAX with precision < 150
+
+			private:
+
+				std::string m_data;
+			};
+
+			class Writer : private boost::noncopyable // note: blocks are formatted by the pool and written in order by one thread
+			{
+			public:
+
+				using path_t = std::filesystem::path;
+
+				using formatter_t = std::function < void(std::size_t, Buffer &) > ;
+
+			public:
+
+				explicit Writer(Executor & executor) noexcept : m_executor(executor)
+				{}
+
+				~Writer() noexcept = default;
+
+			public:
+
+				void write(const path_t & path, std::size_t n_blocks, formatter_t formatter) const;
+
+			private:
+
+				Executor & m_executor;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_WRITER_HPP
\ No newline at end of file
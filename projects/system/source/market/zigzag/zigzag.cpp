@@ -0,0 +1,90 @@
+#include "zigzag.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			Zigzag::swings_container_t Zigzag::make_swings(const prices_container_t & prices) const
+			{
+				RUN_LOGGER(logger);
+
+				try
+				{
+					swings_container_t swings;
+
+					const auto size = std::size(prices);
+
+					for (auto first = 0U; first < size;)
+					{
+						auto flag = false;
+
+						auto min = first; // note: first minimum
+						auto max = first; // note: last maximum
+
+						for (auto last = first + 1U; last < size; ++last)
+						{
+							if (prices[last] < prices[min])
+							{
+								min = last;
+							}
+
+							if (!(prices[last] < prices[max]))
+							{
+								max = last;
+							}
+
+							const auto first_extremum = (min > max ? max : min);
+							const auto last_extremum  = (min > max ? min : max);
+
+							if (!is_swing(prices, first_extremum, last_extremum, min, max, last))
+							{
+								continue;
+							}
+
+							swings.push_back(Swing { first_extremum, last_extremum,
+								(prices[first_extremum] < prices[last_extremum]) });
+
+							first = last_extremum;
+
+							flag = true;
+
+							break;
+						}
+
+						if (!flag)
+						{
+							break;
+						}
+					}
+
+					return swings;
+				}
+				catch (const std::exception & exception)
+				{
+					shared::catch_handler < zigzag_exception > (logger, exception);
+				}
+			}
+
+			bool Zigzag::is_swing(const prices_container_t & prices, std::size_t first_extremum,
+				std::size_t last_extremum, std::size_t min, std::size_t max, std::size_t last) const noexcept
+			{
+				const auto min_price = prices[min];
+				const auto max_price = prices[max];
+
+				return !((((max_price - min_price) / min_price < m_min_price_change) ||
+					(min == last) ||
+					(max == last) || ((last_extremum != last) &&
+						((max_price - min_price) / min_price > m_min_price_change) &&
+						(std::abs(prices[last_extremum] - prices[last]) < m_max_price_rollback *
+							std::abs(prices[first_extremum] - prices[last_extremum])))) &&
+					(std::abs(prices[last_extremum] - prices[last]) /
+						std::min(prices[last_extremum], prices[last]) < m_min_price_change));
+			}
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
\ No newline at end of file
@@ -0,0 +1,86 @@
+#ifndef SOLUTION_SYSTEM_MARKET_ZIGZAG_HPP
+#define SOLUTION_SYSTEM_MARKET_ZIGZAG_HPP
+
+#include <boost/config.hpp>
+
+#ifdef BOOST_HAS_PRAGMA_ONCE
+#  pragma once
+#endif // #ifdef BOOST_HAS_PRAGMA_ONCE
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../../../../shared/source/logger/logger.hpp"
+
+namespace solution
+{
+	namespace system
+	{
+		namespace market
+		{
+			class zigzag_exception : public std::exception
+			{
+			public:
+
+				explicit zigzag_exception(const std::string & message) noexcept :
+					std::exception(message.c_str())
+				{}
+
+				explicit zigzag_exception(const char * const message) noexcept :
+					std::exception(message)
+				{}
+
+				~zigzag_exception() noexcept = default;
+			};
+
+			class Zigzag // note: swings between extrema, running minimum and maximum of each window
+			{
+			public:
+
+				struct Swing
+				{
+					std::size_t first = 0U;
+					std::size_t last  = 0U;
+
+					bool is_long = false;
+				};
+
+				using prices_container_t = std::vector < double > ;
+
+				using swings_container_t = std::vector < Swing > ;
+
+			public:
+
+				explicit Zigzag(double min_price_change, double max_price_rollback) noexcept :
+					m_min_price_change(min_price_change), m_max_price_rollback(max_price_rollback)
+				{}
+
+				~Zigzag() noexcept = default;
+
+			public:
+
+				swings_container_t make_swings(const prices_container_t & prices) const;
+
+			private:
+
+				bool is_swing(const prices_container_t & prices, std::size_t first_extremum,
+					std::size_t last_extremum, std::size_t min, std::size_t max, std::size_t last) const noexcept;
+
+			private:
+
+				const double m_min_price_change;
+				const double m_max_price_rollback;
+			};
+
+		} // namespace market
+
+	} // namespace system
+
+} // namespace solution
+
+#endif // #ifndef SOLUTION_SYSTEM_MARKET_ZIGZAG_HPP
\ No newline at end of file
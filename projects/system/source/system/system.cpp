@@ -24,10 +24,16 @@ namespace solution
 				config.cumulative_distances_asset    = raw_config[Key::Config::cumulative_distances_asset   ].get < std::string > ();
 				config.cumulative_distances_scale_1  = raw_config[Key::Config::cumulative_distances_scale_1 ].get < std::string > ();
 				config.cumulative_distances_scale_2  = raw_config[Key::Config::cumulative_distances_scale_2 ].get < std::string > ();
+				config.required_text_matrices        = raw_config[Key::Config::required_text_matrices       ].get < bool > ();
+				config.required_float32_matrices     = raw_config[Key::Config::required_float32_matrices    ].get < bool > ();
+				config.required_matrices_cache       = raw_config[Key::Config::required_matrices_cache      ].get < bool > ();
 				config.required_price_deviations     = raw_config[Key::Config::required_price_deviations    ].get < bool > ();
 				config.required_tagged_charts        = raw_config[Key::Config::required_tagged_charts       ].get < bool > ();
 				config.required_environment          = raw_config[Key::Config::required_environment         ].get < bool > ();
 				config.required_local_environment    = raw_config[Key::Config::required_local_environment   ].get < bool > ();
+				config.required_dataset              = raw_config[Key::Config::required_dataset             ].get < bool > ();
+				config.required_dry_run              = raw_config[Key::Config::required_dry_run             ].get < bool > ();
+				config.required_dataflow             = raw_config[Key::Config::required_dataflow            ].get < bool > ();
 				config.min_price_change              = raw_config[Key::Config::min_price_change             ].get < double > ();
 				config.max_price_rollback            = raw_config[Key::Config::max_price_rollback           ].get < double > ();
 				config.level_max_deviation           = raw_config[Key::Config::level_max_deviation          ].get < double > ();
@@ -67,19 +73,37 @@ namespace solution
 				config.intraday_test_asset           = raw_config[Key::Config::intraday_test_asset          ].get < std::string > ();
 				config.intraday_test_scale           = raw_config[Key::Config::intraday_test_scale          ].get < std::string > ();
 				config.intraday_test_year            = raw_config[Key::Config::intraday_test_year           ].get < unsigned int > ();
+				config.run_event_study               = raw_config[Key::Config::run_event_study              ].get < bool > ();
+				config.event_study_scale             = raw_config[Key::Config::event_study_scale            ].get < std::string > ();
+				config.event_study_conditions        = raw_config[Key::Config::event_study_conditions       ].get < std::string > ();
+				config.event_study_horizon           = raw_config[Key::Config::event_study_horizon          ].get < std::size_t > ();
+				config.event_study_threshold         = raw_config[Key::Config::event_study_threshold        ].get < double > ();
+				config.event_study_is_relative       = raw_config[Key::Config::event_study_is_relative      ].get < bool > ();
+				config.event_study_confidence        = raw_config[Key::Config::event_study_confidence       ].get < double > ();
+				config.significance_resamples        = raw_config[Key::Config::significance_resamples       ].get < std::size_t > ();
+				config.significance_seed             = raw_config[Key::Config::significance_seed            ].get < std::uint64_t > ();
 				config.local_environment_test_asset  = raw_config[Key::Config::local_environment_test_asset ].get < std::string > ();
 				config.local_environment_test_scale  = raw_config[Key::Config::local_environment_test_scale ].get < std::string > ();
 				config.run_local_environment_test    = raw_config[Key::Config::run_local_environment_test   ].get < bool > ();
 				config.knn_method_parameter          = raw_config[Key::Config::knn_method_parameter         ].get < std::size_t > ();
 				config.geometric_progression_q       = raw_config[Key::Config::geometric_progression_q      ].get < double > ();
 				config.movement_timesteps            = raw_config[Key::Config::movement_timesteps           ].get < std::time_t > ();
+				config.regression_horizons           = raw_config[Key::Config::regression_horizons          ].get < std::size_t > ();
 				config.knn_method_timesteps          = raw_config[Key::Config::knn_method_timesteps         ].get < std::size_t > ();
+				config.run_knn_benchmark             = raw_config[Key::Config::run_knn_benchmark            ].get < bool > ();
+				config.hnsw_max_connections          = raw_config[Key::Config::hnsw_max_connections         ].get < std::size_t > ();
+				config.hnsw_ef_construction          = raw_config[Key::Config::hnsw_ef_construction         ].get < std::size_t > ();
+				config.hnsw_max_ef_search            = raw_config[Key::Config::hnsw_max_ef_search           ].get < std::size_t > ();
+				config.knn_rerank_size               = raw_config[Key::Config::knn_rerank_size              ].get < std::size_t > ();
 				config.max_waves_sequence            = raw_config[Key::Config::max_waves_sequence           ].get < std::size_t > ();
 				config.local_environment_test_start  = raw_config[Key::Config::local_environment_test_start ].get < std::size_t > ();
 				config.max_wave_length               = raw_config[Key::Config::max_wave_length              ].get < std::time_t > ();
 				config.required_test_data            = raw_config[Key::Config::required_test_data           ].get < bool > ();
 				config.test_data_start               = raw_config[Key::Config::test_data_start              ].get < std::size_t > ();
 				config.skipped_timesteps             = raw_config[Key::Config::skipped_timesteps            ].get < std::size_t > ();
+				config.executor_size                 = raw_config[Key::Config::executor_size                ].get < std::size_t > ();
+				config.required_thread_affinity      = raw_config[Key::Config::required_thread_affinity     ].get < bool > ();
+				config.required_numa_placement       = raw_config[Key::Config::required_numa_placement      ].get < bool > ();
 			}
 			catch (const std::exception & exception)
 			{
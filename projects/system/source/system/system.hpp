@@ -110,10 +110,16 @@ namespace solution
 						static inline const std::string cumulative_distances_asset    = "cumulative_distances_asset";
 						static inline const std::string cumulative_distances_scale_1  = "cumulative_distances_scale_1";
 						static inline const std::string cumulative_distances_scale_2  = "cumulative_distances_scale_2";
+						static inline const std::string required_text_matrices        = "required_text_matrices";
+						static inline const std::string required_float32_matrices     = "required_float32_matrices";
+						static inline const std::string required_matrices_cache       = "required_matrices_cache";
 						static inline const std::string required_price_deviations     = "required_price_deviations";
 						static inline const std::string required_tagged_charts        = "required_tagged_charts";
 						static inline const std::string required_environment          = "required_environment";
 						static inline const std::string required_local_environment    = "required_local_environment";
+						static inline const std::string required_dataset              = "required_dataset";
+						static inline const std::string required_dry_run              = "required_dry_run";
+						static inline const std::string required_dataflow             = "required_dataflow";
 						static inline const std::string min_price_change              = "min_price_change";
 						static inline const std::string max_price_rollback            = "max_price_rollback";
 						static inline const std::string level_max_deviation           = "level_max_deviation";
@@ -153,19 +159,37 @@ namespace solution
 						static inline const std::string intraday_test_asset           = "intraday_test_asset";
 						static inline const std::string intraday_test_scale           = "intraday_test_scale";
 						static inline const std::string intraday_test_year            = "intraday_test_year";
+						static inline const std::string run_event_study               = "run_event_study";
+						static inline const std::string event_study_scale             = "event_study_scale";
+						static inline const std::string event_study_conditions        = "event_study_conditions";
+						static inline const std::string event_study_horizon           = "event_study_horizon";
+						static inline const std::string event_study_threshold         = "event_study_threshold";
+						static inline const std::string event_study_is_relative       = "event_study_is_relative";
+						static inline const std::string event_study_confidence        = "event_study_confidence";
+						static inline const std::string significance_resamples        = "significance_resamples";
+						static inline const std::string significance_seed             = "significance_seed";
 						static inline const std::string local_environment_test_asset  = "local_environment_test_asset";
 						static inline const std::string local_environment_test_scale  = "local_environment_test_scale";
 						static inline const std::string run_local_environment_test    = "run_local_environment_test";
 						static inline const std::string knn_method_parameter          = "knn_method_parameter";
 						static inline const std::string geometric_progression_q       = "geometric_progression_q";
 						static inline const std::string movement_timesteps            = "movement_timesteps";
+						static inline const std::string regression_horizons           = "regression_horizons";
 						static inline const std::string knn_method_timesteps          = "knn_method_timesteps";
+						static inline const std::string run_knn_benchmark             = "run_knn_benchmark";
+						static inline const std::string hnsw_max_connections          = "hnsw_max_connections";
+						static inline const std::string hnsw_ef_construction          = "hnsw_ef_construction";
+						static inline const std::string hnsw_max_ef_search            = "hnsw_max_ef_search";
+						static inline const std::string knn_rerank_size               = "knn_rerank_size";
 						static inline const std::string max_waves_sequence            = "max_waves_sequence";
 						static inline const std::string local_environment_test_start  = "local_environment_test_start";
 						static inline const std::string max_wave_length               = "max_wave_length";
 						static inline const std::string required_test_data            = "required_test_data";
 						static inline const std::string test_data_start               = "test_data_start";
 						static inline const std::string skipped_timesteps             = "skipped_timesteps";
+						static inline const std::string executor_size                 = "executor_size";
+						static inline const std::string required_thread_affinity      = "required_thread_affinity";
+						static inline const std::string required_numa_placement       = "required_numa_placement";
 					};
 				};
 